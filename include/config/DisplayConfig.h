@@ -18,8 +18,11 @@ limitations under the License.
 */
 #pragma once
 
+#include <optional>  // for optional
+
 #include "ScoreboardCommon.h"
-#include "config.pb.h"  // for DisplayConfig, DisplayInfo, ScreenSide (ptr o...
+#include "config.pb.h"        // for DisplayConfig, DisplayInfo, ScreenSid...
+#include "config/Position.h"  // for Size
 #include "util/Singleton.h"
 
 namespace cszb_scoreboard {
@@ -36,6 +39,9 @@ class DisplayConfig {
   void detectDisplays(bool force_reload = false);
   auto displayDetails(int index) -> proto::DisplayInfo;
   auto numberOfDisplays() -> int;
+  // The smallest size which every display fits within, or nullopt if there are
+  // no displays yet.
+  auto largestDisplaySize() -> std::optional<Size>;
   void saveSettings();
   // Set the display id to the given monitor index.  Returns true if this
   // was an effective change, false if the values were identical already.
@@ -18,6 +18,8 @@ limitations under the License.
 */
 #pragma once
 
+#include <cstdint>  // for int32_t
+
 #include "ScoreboardCommon.h"  // for PUBLIC_TEST_ONLY
 #include "config.pb.h"         // for GeneralConfig
 #include "util/Singleton.h"    // for Singleton, SingletonClass
@@ -34,6 +36,8 @@ class GeneralConfig {
   // GCOVR_EXCL_STOP
   void setDropShadowDistance(double distance);
   auto dropShadowDistance() -> double;
+  void setImageCacheMegabytes(int32_t megabytes);
+  auto imageCacheMegabytes() -> int32_t;
   void saveSettings();
 
   PUBLIC_TEST_ONLY
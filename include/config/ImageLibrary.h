@@ -18,13 +18,19 @@ limitations under the License.
 */
 #pragma once
 
-#include <cstddef>  // for size_t
-#include <memory>   // for unique_ptr
-#include <string>   // for string, basic_string
-#include <vector>   // for vector
+#include <cstddef>        // for size_t
+#include <cstdint>        // for uint32_t, uint64_t
+#include <map>            // for map
+#include <memory>         // for unique_ptr, shared_ptr
+#include <optional>       // for optional
+#include <string>         // for string, basic_string
+#include <unordered_map>  // for unordered_map
+#include <vector>         // for vector
 
 #include "ScoreboardCommon.h"  // for PUBLIC_TEST_ONLY
 #include "image_library.pb.h"  // for ImageInfo, ImageLibrary
+#include "util/LruCache.h"     // for LruCache
+#include "util/NgramIndex.h"   // for NgramIndex
 
 namespace cszb_scoreboard {
 class FilesystemPath;
@@ -96,12 +102,13 @@ class ImageSearchResults {
   auto matchedTags() -> std::vector<std::string>;
 
  private:
-  ImageSearchResults(const std::vector<proto::ImageInfo>& matched_images,
-                     const std::string& search_string,
-                     const std::vector<CaseOptionalString>& matched_tag_list);
-  std::vector<proto::ImageInfo> matched_images;
+  ImageSearchResults(std::vector<proto::ImageInfo> matched_images,
+                     std::string search_string,
+                     std::vector<CaseOptionalString> matched_tag_list);
+  // Shared between copies, as the library keeps recent results to return again.
+  std::shared_ptr<const std::vector<proto::ImageInfo>> matched_images;
   std::string search_string;
-  std::vector<CaseOptionalString> matched_tag_list;
+  std::shared_ptr<const std::vector<CaseOptionalString>> matched_tag_list;
   friend class ImageLibrary;
 };
 
@@ -124,6 +131,9 @@ class ImageLibrary {
   auto moveImage(const FilesystemPath& previous_path,
                  const FilesystemPath& new_path) -> proto::ImageInfo;
   void deleteImage(const FilesystemPath& file);
+  // Deletes an image for each of files, updating the library's indexes once
+  // for all of them rather than once per image.
+  void deleteImages(const std::vector<FilesystemPath>& files);
   auto libraryRoot() -> FilesystemPath;
   void removeLibraryRoot();
   // moveLibraryRoot moves the root without changing any relative paths.  Use
@@ -160,14 +170,69 @@ class ImageLibrary {
   bool enable_persistence = true;
 
  private:
+  using TagId = uint32_t;
+  // A single name or tag, stored once however many images use it, along with
+  // where it's used, by position in library.images().  Positions are kept
+  // sorted, and an image appears once for each time it uses the string, so
+  // that removing one use leaves the others in place.
+  struct TagEntry {
+    CaseOptionalString tag;
+    std::vector<size_t> named;
+    std::vector<size_t> tagged;
+  };
+  // The name and tags of a single image, as ids of their entries.
+  struct ImageTags {
+    TagId name;
+    std::vector<TagId> tags;
+  };
+  // Results of a search, and the generation of the library they came from.
+  struct CachedSearch {
+    uint64_t generation;
+    ImageSearchResults results;
+  };
+
+  // Images are held here without their tags, which are kept in image_tags
+  // instead and only filled back in when an image leaves this class.
   proto::ImageLibrary library;
   Singleton* singleton;
+  // Every name and tag, by id.  Entries no longer used by any image have their
+  // ids listed in free_tag_ids, to be reused by the next new string.
+  std::vector<TagEntry> tag_entries;
+  std::vector<TagId> free_tag_ids;
+  // The id of every name and tag in use, in sorted order.
+  std::map<CaseOptionalString, TagId> tag_ids;
+  // The lowercase form of every name and tag in use, for partial searches.
+  NgramIndex<TagId> tag_grams;
+  // The name and tags of each image in library.images(), in the same order.
+  std::vector<ImageTags> image_tags;
+  // The position of each image, by its path as stored in the library, so that
+  // changes to a single image don't need to search for it.
+  std::unordered_map<std::string, std::vector<size_t>> path_index;
+  // Bumped by every change to the library, so that cached searches from before
+  // the change are no longer returned.
+  uint64_t generation = 0;
+  LruCache<std::string, CachedSearch> search_cache;
+  auto internTag(const std::string& value) -> TagId;
+  void addUse(TagId id, std::vector<size_t> TagEntry::*uses, size_t position);
+  void removeUse(TagId id, std::vector<size_t> TagEntry::*uses,
+                 size_t position);
+  auto indexTags(const std::vector<std::string>& tags, size_t position)
+      -> std::vector<TagId>;
+  void rebuildIndex();
+  [[nodiscard]] auto withTags(size_t position) const -> proto::ImageInfo;
+  [[nodiscard]] auto exportLibrary() const -> proto::ImageLibrary;
+  void indexPath(const std::string& path, size_t position);
+  void rebuildPathIndex();
+  [[nodiscard]] auto imagePosition(const FilesystemPath& file) const
+      -> std::optional<size_t>;
+  auto uncachedSearch(const std::string& query) -> ImageSearchResults;
   auto emptySearch() -> ImageSearchResults;
   auto exactMatchSearch(const std::string& query) -> ImageSearchResults;
-  auto infoByFile(const FilesystemPath& filename) -> proto::ImageInfo;
   auto partialMatchSearch(const std::string& query) -> ImageSearchResults;
   void addMatch(std::vector<proto::ImageInfo>* matched_images,
                 const proto::ImageInfo& image);
+  auto imagesAt(const std::vector<size_t>& positions)
+      -> std::vector<proto::ImageInfo>;
 };
 
 // A non-singleton subclass of the singleton ImageLibrary which turns off all
@@ -18,17 +18,19 @@ limitations under the License.
 */
 #pragma once
 
-#include <stdint.h>  // for int32_t
+#include <stddef.h>  // for size_t
+#include <stdint.h>  // for int32_t, int64_t
 
-#include <chrono>  // IWYU pragma: keep for seconds
-#include <string>  // for string
-#include <vector>  // for vector
+#include <optional>  // for optional
+#include <string>    // for string
+#include <vector>    // for vector
 
-#include "ScoreboardCommon.h"  // for PUBLIC_TEST_ONLY
-#include "slide_show.pb.h"     // for SlideShow, SlideInfo (ptr only)
-#include "ui/widget/Image.h"   // for Image
-#include "util/Singleton.h"    // for Singleton, SingletonClass
-// IWYU pragma: no_include <bits/chrono.h>
+#include "ScoreboardCommon.h"         // for PUBLIC_TEST_ONLY
+#include "config/Position.h"          // for Size
+#include "slide_show.pb.h"            // for SlideShow, SlideInfo (ptr only)
+#include "ui/graphics/ImageLoader.h"  // for ImageLoader
+#include "ui/widget/Image.h"          // for Image
+#include "util/Singleton.h"           // for Singleton, SingletonClass
 
 namespace cszb_scoreboard {
 class FilesystemPath;
@@ -53,22 +55,69 @@ class SlideShow {
     return slide_show.delay() > 0 ? slide_show.delay()
                                   : DEFAULT_SLIDESHOW_DELAY;
   }
-  void setDelay(double delay) { slide_show.set_delay(delay); }
+  // Takes effect immediately in a running show, so the current slide is shown
+  // for the new delay from when it first appeared.
+  void setDelay(double delay);
   [[nodiscard]] auto isRunning() const -> bool { return is_running; }
   void start();
   void stop();
-  auto nextSlide() -> Image;
+  // Moves the show on to the slide which is due at now (on the
+  // AnimationClock).  This is the only place the show advances, and is driven
+  // by the AutoRefreshTimer, which wakes at each transition.
+  void advance(int64_t now);
+  // Returns the image for the current slide, scaled to fit_size.  Upcoming
+  // slides are loaded and scaled in the background ahead of time, and if one
+  // still isn't ready when it's due, the previous slide is returned until it
+  // is.
+  auto currentSlide(const Size& fit_size) -> Image;
+  // Returns the time (on the AnimationClock) of the first transition after
+  // after_ms, which may already have happened, or nullopt if the show is not
+  // running.
+  [[nodiscard]] auto nextTransition(int64_t after_ms) const
+      -> std::optional<int64_t>;
 
   PUBLIC_TEST_ONLY
   SlideShow(SingletonClass c, Singleton* singleton);
+  [[nodiscard]] auto slideNumber() const -> int32_t { return slide_number; }
+  [[nodiscard]] auto preparedSizes() const -> size_t {
+    return prefetch_queues.size();
+  }
 
  private:
+  struct PrefetchedSlide {
+    std::string file_path;
+    ImageLoader::Request request;
+  };
+  // The slides being prepared for one size of screen, starting with the
+  // current slide, along with the image last shown at that size.
+  struct PrefetchQueue {
+    Size fit_size;
+    std::vector<PrefetchedSlide> slides;
+    Image shown;
+    // Whether a slide has been asked for at this size since the last
+    // transition.
+    bool requested = true;
+  };
+
   proto::SlideShow slide_show;
   Singleton* singleton;
   int32_t slide_number = 0;
   bool is_running = false;
-  std::chrono::seconds last_transition;
-  Image cached_image;
-  int32_t last_returned_slide_number = -1;
+  // Transition times, in milliseconds on the AnimationClock.  Each transition
+  // is scheduled a whole number of delays after the show started, so they
+  // don't drift regardless of when they're actually processed.
+  int64_t last_transition = 0;
+  int64_t next_transition = 0;
+  std::vector<PrefetchQueue> prefetch_queues;
+
+  [[nodiscard]] auto delayMillis() -> int64_t;
+  auto prefetchQueue(const Size& fit_size) -> PrefetchQueue*;
+  void dropUnrequestedQueues();
+  // Updates the prepared slides for every size, while the show is running.
+  void prefetch();
+  void prefetch(PrefetchQueue* queue);
+  void slideLoaded(const std::string& file_path);
+  void requestRefresh();
+  void wakeRefreshTimer();
 };
 }  // namespace cszb_scoreboard
@@ -19,9 +19,11 @@ limitations under the License.
 
 #pragma once
 
-#include <memory>  // for unique_ptr
-#include <string>  // for string
-#include <vector>  // for vector
+#include <cstdint>   // for int64_t
+#include <memory>    // for unique_ptr
+#include <optional>  // for optional
+#include <string>    // for string
+#include <vector>    // for vector
 
 #include "ScoreboardCommon.h"                           // for PUBLIC_TEST_ONLY
 #include "ui/component/control/ScreenTextController.h"  // for ScreenTextCon...
@@ -48,6 +50,7 @@ class ControlPanel : public Notebook {
   void updateScreenTextFromSelected(ScreenText* screen_text);
   auto isSelected(ScreenTextController* controller) const -> bool;
   void refresh() const override;
+  auto refreshAnimations(int64_t now) const -> std::optional<int64_t>;
 
   PUBLIC_TEST_ONLY
   ControlPanel(swx::Notebook* wx, Singleton* singleton);
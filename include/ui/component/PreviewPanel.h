@@ -20,8 +20,10 @@ limitations under the License.
 
 #pragma once
 
+#include <cstdint>     // for int64_t
 #include <functional>  // for function
 #include <memory>      // for unique_ptr
+#include <optional>    // for optional
 #include <vector>      // for vector
 
 #include "ScoreboardCommon.h"            // for PUBLIC_TEST_ONLY
@@ -51,6 +53,7 @@ class PreviewPanel : public DraggablePanel {
   void updatePresenters();
   void updatePreviewsFromSettings();
   void refresh() const override;
+  auto refreshAnimations(int64_t now) const -> std::optional<int64_t>;
 
   PUBLIC_TEST_ONLY
   explicit PreviewPanel(swx::Panel* wx, Singleton* singleton);
@@ -18,9 +18,11 @@ limitations under the License.
 
 #pragma once
 
-#include <memory>  // for unique_ptr
-#include <string>  // for string
-#include <vector>  // for vector
+#include <cstdint>   // for int64_t
+#include <memory>    // for unique_ptr
+#include <optional>  // for optional
+#include <string>    // for string
+#include <vector>    // for vector
 
 #include "ScoreboardCommon.h"
 #include "ui/component/ScreenText.h"  // for ScreenText
@@ -65,6 +67,7 @@ class QuickStatePanel : public Panel {
   static void setShortcut(QuickStateEntry* entry, Singleton* singleton);
   auto scorePanel() -> ScreenText* { return score_entry.get(); }
   void refresh() const override;
+  auto refreshAnimations(int64_t now) const -> std::optional<int64_t>;
 
   PUBLIC_TEST_ONLY
   QuickStatePanel(swx::Panel* wx, Singleton* singleton);
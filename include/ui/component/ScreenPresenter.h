@@ -18,7 +18,9 @@ limitations under the License.
 */
 #pragma once
 
-#include <memory>  // for unique_ptr
+#include <cstdint>   // for int64_t
+#include <memory>    // for unique_ptr
+#include <optional>  // for optional
 
 #include "ScoreboardCommon.h"
 #include "ui/component/ScreenText.h"  // for ScreenText
@@ -37,6 +39,7 @@ class ScreenPresenter : public Frame {
   void blackout() { screen_text->blackout(); }
   void setAll(const ScreenText& source) { screen_text->setAll(source); }
   void refreshWindow() override;
+  auto refreshAnimations(int64_t now) -> std::optional<int64_t> override;
 
   PUBLIC_TEST_ONLY
   ScreenPresenter(int monitor_number, const ScreenText& preview,
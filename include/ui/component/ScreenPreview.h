@@ -20,10 +20,12 @@ limitations under the License.
 */
 #pragma once
 
-#include <memory>   // for unique_ptr
-#include <string>   // for string
-#include <utility>  // for move
-#include <vector>   // for vector
+#include <cstdint>   // for int64_t
+#include <memory>    // for unique_ptr
+#include <optional>  // for optional
+#include <string>    // for string
+#include <utility>   // for move
+#include <vector>    // for vector
 
 #include "ScoreboardCommon.h"              // for PUBLIC_TEST_ONLY
 #include "config.pb.h"                     // for ScreenSide, RenderableText...
@@ -84,6 +86,7 @@ class ScreenPreview : public Panel {
     screen_text->setImage(image, side);
   }
   void refresh();
+  auto refreshAnimations(int64_t now) const -> std::optional<int64_t>;
 
   PUBLIC_TEST_ONLY
   ScreenPreview(swx::Panel* wx, std::vector<proto::ScreenSide> sides,
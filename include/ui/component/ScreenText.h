@@ -19,8 +19,10 @@ limitations under the License.
 
 #pragma once
 
-#include <string>  // for string
-#include <vector>  // for vector
+#include <cstdint>   // for int64_t
+#include <optional>  // for optional
+#include <string>    // for string
+#include <vector>    // for vector
 
 #include "ScoreboardCommon.h"  // for PUBLIC_TEST_ONLY
 #include "config/Position.h"   // for Size
@@ -89,6 +91,9 @@ class ScreenText : public Panel {
   void setAutoFit(bool auto_fit, const proto::ScreenSide& side);
   void refresh() const override;
   [[nodiscard]] auto hasAnimation() const -> bool;
+  // Refreshes any side whose animated content has changed since it was last
+  // painted, and returns when this should next be called, if ever.
+  auto refreshAnimations(int64_t now) const -> std::optional<int64_t>;
   auto sides() -> std::vector<ScreenTextSide*> { return text_sides; }
 
   PUBLIC_TEST_ONLY
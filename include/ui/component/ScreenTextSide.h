@@ -20,20 +20,23 @@ limitations under the License.
 
 #pragma once
 
+#include <cstddef>   // for size_t
+#include <cstdint>   // for int64_t, uint64_t
 #include <optional>  // for optional
 #include <string>    // for string
 #include <vector>    // for vector
 
-#include "ScoreboardCommon.h"   // for PUBLIC_TEST_ONLY
-#include "config.pb.h"          // for RenderableText, Font (ptr only), Scre...
-#include "config/Position.h"    // for Position, Size
-#include "ui/graphics/Color.h"  // for Color
-#include "ui/widget/Canvas.h"   // for Panel
-#include "ui/widget/Image.h"    // for Image
+#include "ScoreboardCommon.h"           // for PUBLIC_TEST_ONLY
+#include "config.pb.h"                  // for RenderableText, Font (ptr on...
+#include "config/Position.h"            // for Position, Size
+#include "ui/graphics/Color.h"          // for Color
+#include "ui/widget/Canvas.h"           // for Panel
+#include "ui/widget/Image.h"            // for Image
+#include "ui/widget/LayerCompositor.h"  // for LayerCompositor
+#include "ui/widget/RenderContext.h"    // for RenderContext
 #include "util/Singleton.h"
 
 namespace cszb_scoreboard {
-class RenderContext;
 
 namespace swx {
 class Panel;
@@ -43,6 +46,10 @@ enum class OverlayScreenPosition { Centered, BottomLeft };
 
 enum class ScreenTextCategory { Preview, Presenter };
 
+// The layers composited to draw a side, from the bottom up.
+enum class ScreenLayer { Background, Overlay, Text, Timer };
+constexpr size_t SCREEN_LAYER_COUNT = 4;
+
 class ScreenTextSide : public Canvas {
  public:
   // GCOVR_EXCL_START - This class uses our singleton objects.  In test, we
@@ -82,6 +89,9 @@ class ScreenTextSide : public Canvas {
   auto side() -> const proto::ScreenSide& { return screen_side; }
   auto isSide(const proto::ScreenSide& side) -> bool;
   [[nodiscard]] auto hasAnimation() const -> bool;
+  // Refreshes this side if it has changed since it was last painted, then
+  // returns the time at which it should next be refreshed, if ever.
+  auto refreshAnimation(int64_t now) -> std::optional<int64_t>;
 
   PUBLIC_TEST_ONLY
   ScreenTextSide(swx::Panel* wx, const std::string& initial_text,
@@ -93,6 +103,28 @@ class ScreenTextSide : public Canvas {
       -> Size;
 
  private:
+  // Everything about the timer which only depends on the size of the side, so
+  // that a running timer only has to draw the time.
+  struct TimerChrome {
+    Size side_size;
+    proto::Font font;
+    Position placement;
+    Image shading;
+    int64_t shade_top = 0;
+  };
+
+  // Everything needed to draw a text which doesn't change from paint to paint,
+  // along with the inputs it was measured for.
+  struct TextLayout {
+    std::string text;
+    proto::Font_FontStyle font_style;
+    float font_size;
+    proto::RenderableText_ScreenPosition position;
+    Size side_size;
+    std::vector<RenderContext::TextLine> lines;
+    Position placement;
+  };
+
   bool auto_fit_text;
   Image blackout_image;
   std::optional<Color> background_color;
@@ -104,43 +136,59 @@ class ScreenTextSide : public Canvas {
   bool image_is_scaled;
   proto::ScreenSide screen_side;
   std::vector<proto::RenderableText> texts;
+  // Parallel to texts, filled in as each one is first drawn.
+  std::vector<std::optional<TextLayout>> text_layouts;
   Singleton* singleton;
   ScreenTextCategory category;
+  LayerCompositor compositor{SCREEN_LAYER_COUNT};
+  std::vector<LayerCompositor::LayerRenderer> layer_renderers;
+  std::optional<Image> current_slide;
+  int64_t last_paint_ms = 0;
 
-  Image scaled_image;
-  Image last_source_image;
-  Size last_target_size;
+  std::optional<TimerChrome> timer_chrome;
 
   Image scaled_overlay;
-  Image last_overlay_source_image;
+  uint64_t last_overlay_source_id = 0;
   Size last_overlay_target_size;
   Color last_overlay_font_color;
+  unsigned char last_overlay_alpha = 0;
 
   ScreenTextSide(Singleton* singleton, swx::Panel* wx,
                  const proto::ScreenSide& side);
-  static auto ratio(const Size& size) -> float;
-  static auto scaleImage(const Image& image, const Size& target_size) -> Image;
   void autoFitText(RenderContext* renderer, proto::RenderableText* text);
   void bindEvents();
   void adjustOverlayColorAndAlpha(Image* image, const Color& color) const;
-  auto bottomText(RenderContext* renderer, const std::string& text) -> Position;
-  auto centerText(RenderContext* renderer, const std::string& text) -> Position;
+  auto bottomText(const Size& text_extent) -> Position;
+  auto centerText(const Size& text_extent) -> Position;
   void createBlackout();
+  auto fittedFontSize(RenderContext* renderer,
+                      const proto::RenderableText& text) -> float;
   void initializeForColor(Size size, const Color& color);
+  void invalidateLayer(ScreenLayer layer);
+  void invalidateText();
+  [[nodiscard]] auto nextLayerChange(ScreenLayer layer, int64_t after_ms) const
+      -> std::optional<int64_t>;
   auto positionText(RenderContext* renderer, const proto::RenderableText& text)
       -> Position;
+  auto positionText(proto::RenderableText_ScreenPosition position,
+                    const Size& text_extent) -> Position;
+  void refreshLayerArea(ScreenLayer layer);
   void renderBackground(RenderContext* renderer);
   void renderOverlay(RenderContext* renderer);
   void renderOverlayBottomCorner(RenderContext* renderer);
   void renderOverlayCentered(RenderContext* renderer);
-  auto renderSlide(RenderContext* renderer) -> bool;
   void renderScaledBackground(RenderContext* renderer, const Image& image);
-  void renderShadowText(RenderContext* renderer, proto::RenderableText* text);
-  void renderText(RenderContext* renderer, proto::RenderableText* text);
+  void renderShadowText(RenderContext* renderer, size_t index);
+  void renderText(RenderContext* renderer, size_t index);
   void renderTimer(RenderContext* renderer);
   void renderAllText(RenderContext* renderer);
   void setBackground(const Color& color);
-  auto topText(RenderContext* renderer, const std::string& text) -> Position;
+  auto textLayout(RenderContext* renderer, size_t index) -> const TextLayout&;
+  auto topText(const Size& text_extent) -> Position;
+  void updateTimerChrome(RenderContext* renderer);
+  void updateLayerStamps(int64_t now);
+  void updateScaledOverlay(const Size& target_size);
+  void wakeForAnimation(const Image& image);
 };
 
 }  // namespace cszb_scoreboard
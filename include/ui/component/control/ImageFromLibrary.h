@@ -44,6 +44,7 @@ class ImageFromLibrary : public ScreenImageController {
   static auto Create(swx::Panel* wx) -> std::unique_ptr<ImageFromLibrary>;
   void onEditDialogClose();
   void refresh() const override;
+  [[nodiscard]] auto hasAnimation() const -> bool override;
 
  private:
   int current_image_page = 0;
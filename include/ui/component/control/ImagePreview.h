@@ -21,12 +21,14 @@ limitations under the License.
 
 #include <optional>  // for optional
 
-#include "ui/widget/Image.h"      // for Image
-#include "ui/widget/Panel.h"      // for Panel
-#include "util/FilesystemPath.h"  // for FilesystemPath
+#include "ScoreboardCommon.h"         // for PUBLIC_TEST_ONLY
+#include "ui/graphics/ImageLoader.h"  // for ImageLoader
+#include "ui/widget/Image.h"          // for Image
+#include "ui/widget/Panel.h"          // for Panel
+#include "util/FilesystemPath.h"      // for FilesystemPath
+#include "util/Singleton.h"           // for Singleton
 
 namespace cszb_scoreboard {
-struct Size;
 class RenderContext;
 
 namespace swx {
@@ -35,7 +37,12 @@ class Panel;
 
 class ImagePreview : public Panel {
  public:
-  explicit ImagePreview(swx::Panel* wx);
+  // GCOVR_EXCL_START - This class uses our singleton objects.  In test, we
+  // always call the constructor that passes in the Singleton object, as it
+  // allows mocking of singletons.
+  explicit ImagePreview(swx::Panel* wx)
+      : ImagePreview(wx, Singleton::getInstance()) {}
+  // GCOVR_EXCL_STOP
 
   void clearImage();
   [[nodiscard]] auto getFilename() const -> std::optional<FilesystemPath>;
@@ -45,13 +52,18 @@ class ImagePreview : public Panel {
   const static int PREVIEW_WIDTH = 160;
   const static int PREVIEW_HEIGHT = 90;
 
+  PUBLIC_TEST_ONLY
+  ImagePreview(swx::Panel* wx, Singleton* singleton);
+
  private:
   void bindEvents();
   void paintEvent(RenderContext* renderer);
-  static auto ratio(const Size& size) -> float;
 
   std::optional<FilesystemPath> filename;
   Image image;
+  // The placeholder color is shown in place of the image while this is pending.
+  ImageLoader::Request loading;
+  Singleton* singleton;
 };
 
 }  // namespace cszb_scoreboard
@@ -27,6 +27,7 @@ limitations under the License.
 #include "ScoreboardCommon.h"                           // for PUBLIC_TEST_ONLY
 #include "ui/component/control/ScreenTextController.h"  // for ScreenTextCon...
 #include "ui/dialog/TeamLibraryDialog.h"                // for TeamLibraryDi...
+#include "ui/graphics/ImageLoader.h"                    // for ImageLoader
 #include "ui/widget/Button.h"                           // for Button
 #include "ui/widget/ColorPicker.h"                      // for ColorPicker
 #include "ui/widget/Image.h"                            // for Image
@@ -36,6 +37,7 @@ limitations under the License.
 #include "ui/widget/Toggle.h"                           // for Toggle
 
 namespace cszb_scoreboard {
+class FilesystemPath;
 class ScreenText;
 class Widget;
 
@@ -110,10 +112,13 @@ class ScoreControl : public ScreenTextController {
   void homeAddFive();
   void homeMinusOne();
   void selectLogo(bool isHome);
+  void loadLogo(bool isHome, const FilesystemPath& file);
   void toggleIntroMode();
   void selectFromLibrary();
 
   std::optional<Image> home_logo, away_logo;
+  // A logo is left off of the screen while a new one is loading.
+  ImageLoader::Request home_logo_loading, away_logo_loading;
   std::unique_ptr<Text> alpha_ctrl, size_ctrl;
   std::unique_ptr<Panel> right_panel;
   std::unique_ptr<Toggle> team_intro_button;
@@ -27,10 +27,12 @@ limitations under the License.
 
 #include "ui/component/control/ScreenTextController.h"  // for ScreenTextCon...
 #include "ui/component/control/TeamSelector.h"          // for TeamSelector
+#include "ui/graphics/ImageLoader.h"                    // for ImageLoader
 #include "ui/widget/Image.h"
 #include "ui/widget/Label.h"  // for Label
 
 namespace cszb_scoreboard {
+class FilesystemPath;
 class Panel;
 class ScreenText;
 
@@ -45,11 +47,18 @@ class ScreenImageController : public ScreenTextController {
   Image all_screen_image, home_screen_image, away_screen_image;
   std::string all_screen_image_name, home_screen_image_name,
       away_screen_image_name;
+  // Each screen's image is left empty (and so isn't sent to the screen) while
+  // a new one is loading.
+  ImageLoader::Request all_screen_loading, home_screen_loading,
+      away_screen_loading;
 
   explicit ScreenImageController(swx::Panel* wx) : ScreenTextController(wx) {}
   void bindEvents();
   void createControls(Panel* control_panel) override;
   virtual void positionWidgets(Panel* control_panel) = 0;
+  // Loads an image for the currently selected screen in the background, and
+  // updates the preview with it once it's ready.
+  void loadScreenImage(const FilesystemPath& file, const std::string& name);
   void screenChanged();
   void updateScreenText(ScreenText* screen_text) override;
 };
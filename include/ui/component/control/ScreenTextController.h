@@ -46,6 +46,7 @@ class ScreenTextController : public Panel {
   /* May be used to select the current preview panel*/
   void updatePreview();
   void refresh() const override;
+  [[nodiscard]] virtual auto hasAnimation() const -> bool { return false; }
 
  protected:
   /* Populate this control_panel in child classes with whatever controls this
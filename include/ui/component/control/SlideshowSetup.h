@@ -45,6 +45,7 @@ class SlideshowSetup : public ScreenTextController {
                              /*display_update_screens=*/false) {}
   static auto Create(swx::Panel* wx) -> std::unique_ptr<SlideshowSetup>;
   void refresh() const override;
+  [[nodiscard]] auto hasAnimation() const -> bool override;
   void moveSlideLeft(int32_t index);
   void moveSlideRight(int32_t index);
   void removeSlide(int32_t index);
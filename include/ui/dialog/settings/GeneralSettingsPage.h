@@ -23,7 +23,9 @@ limitations under the License.
 #include "ScoreboardCommon.h"                 // for PUBLIC_TEST_ONLY
 #include "ui/dialog/settings/SettingsPage.h"  // for SettingsPage
 #include "ui/widget/CheckBox.h"               // for CheckBox
+#include "ui/widget/Label.h"                  // for Label
 #include "ui/widget/Panel.h"                  // for Panel
+#include "ui/widget/Text.h"                   // for Text
 #include "util/Singleton.h"                   // for Singleton
 
 namespace cszb_scoreboard {
@@ -53,6 +55,8 @@ class GeneralSettingsPage : public SettingsPage {
 
   std::unique_ptr<Panel> general_settings;
   std::unique_ptr<CheckBox> enable_drop_shadow;
+  std::unique_ptr<Label> image_cache_label;
+  std::unique_ptr<Text> image_cache_megabytes;
   Singleton* singleton;
 };
 
@@ -1,6 +1,7 @@
 /*
-ui/event/AutoRefreshTimer.h: A timer which forces all of the frames to repaint
-periodically.
+ui/event/AutoRefreshTimer.h: A timer which repaints frames on request, and
+which repaints animated content at the moment it next changes, for as long as
+there is any on screen.
 
 Copyright 2021-2026 Tracy Beck
 
@@ -21,6 +22,9 @@ limitations under the License.
 
 #include <ui/widget/PersistentTimer.h>  // for PersistentTimer
 
+#include <cstdint>   // for int64_t
+#include <optional>  // for optional
+
 #include "ScoreboardCommon.h"  // for PUBLIC_TEST_ONLY
 #include "util/Singleton.h"    // for Singleton
 
@@ -35,12 +39,23 @@ class AutoRefreshTimer : public PersistentTimer {
       : AutoRefreshTimer(Singleton::getInstance()) {}
   // GCOVR_EXCL_STOP
 
+  // Refreshes every frame on the next tick, then keeps refreshing animated
+  // content each time it changes, for as long as there is any.
+  void requestRefresh();
+  // Checks animated content right away, unless a check is already due sooner.
+  // Call this whenever something which may animate is put on screen.
+  void wake();
+
   PUBLIC_TEST_ONLY
   explicit AutoRefreshTimer(Singleton* singleton);
 
  private:
   void execute();
+  void schedule(int delay_millis);
   Singleton* singleton;
+  bool full_refresh_requested = false;
+  // When the pending tick is due (on the AnimationClock), if one is pending.
+  std::optional<int64_t> scheduled_for;
 };
 
 }  // namespace cszb_scoreboard
\ No newline at end of file
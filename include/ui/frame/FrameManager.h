@@ -21,10 +21,11 @@ limitations under the License.
 */
 #pragma once
 
-#include <cstdint>  // for int32_t, uint32_t
-#include <memory>   // for unique_ptr
-#include <set>      // for set
-#include <string>   // for string
+#include <cstdint>   // for int32_t, int64_t, uint32_t
+#include <memory>    // for unique_ptr
+#include <optional>  // for optional
+#include <set>       // for set
+#include <string>    // for string
 
 #include "ui/frame/MainView.h"  // for MainView
 #include "ui/widget/Display.h"  // for Display
@@ -48,6 +49,7 @@ class FrameManager {
   void clearPresenters();
   virtual auto mainView() -> MainView* { return main_view.get(); }
   virtual void refreshFrames();
+  virtual auto refreshAnimations(int64_t now) -> std::optional<int64_t>;
   virtual void exitFrames();
   virtual auto monitorCount() -> int32_t { return Display::numDisplays(); }
   virtual auto monitor(uint32_t index) -> Display;
@@ -21,8 +21,10 @@ limitations under the License.
 #include <wx/defs.h>    // for wxID_ANY
 #include <wx/string.h>  // for wxString
 
-#include <memory>  // for unique_ptr
-#include <string>  // for string
+#include <cstdint>   // for int64_t
+#include <memory>    // for unique_ptr
+#include <optional>  // for optional
+#include <string>    // for string
 
 #include "ScoreboardCommon.h"              // for PUBLIC_TEST_ONLY
 #include "config/Position.h"               // for Position, Size
@@ -34,6 +36,7 @@ limitations under the License.
 #include "ui/event/UpdateTimer.h"  // for UpdateTimer
 #include "ui/widget/Frame.h"       // for Frame
 #include "ui/widget/swx/Frame.h"   // for FrameImpl, Frame (ptr only)
+#include "util/AnimationClock.h"   // for AnimationClock
 #include "util/Singleton.h"        // for Singleton
 
 class wxNotebook;
@@ -72,6 +75,22 @@ class MainView : public Frame {
       control_panel->refresh();
     }
   }
+  auto refreshAnimations(int64_t now) -> std::optional<int64_t> override {
+    std::optional<int64_t> next;
+    if (preview_panel != nullptr) {
+      next = AnimationClock::earliest(next,
+                                      preview_panel->refreshAnimations(now));
+    }
+    if (quick_state != nullptr) {
+      next =
+          AnimationClock::earliest(next, quick_state->refreshAnimations(now));
+    }
+    if (control_panel != nullptr) {
+      next = AnimationClock::earliest(next,
+                                      control_panel->refreshAnimations(now));
+    }
+    return next;
+  }
 
   PUBLIC_TEST_ONLY
   MainView(swx::Frame* wx, Singleton* singleton);
@@ -0,0 +1,113 @@
+/*
+ui/graphics/GifDecoder.h: Decodes and composites the frames of an animated GIF
+one at a time, as they are needed, rather than all at once.
+
+Copyright 2026 Tracy Beck
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+*/
+#pragma once
+
+#include <cstddef>   // for size_t
+#include <cstdint>   // for uint8_t
+#include <optional>  // for optional
+#include <vector>    // for vector
+
+namespace cszb_scoreboard {
+
+/* Only the structure of the file is parsed up front.  The compressed data is
+ * retained and each frame is decompressed when the canvas is advanced to it,
+ * so memory use is the size of the file plus a single canvas, no matter how
+ * many frames the animation has.
+ *
+ * The canvas is kept in the same layout as a wxImage: three bytes of RGB per
+ * pixel plus a separate alpha plane. */
+class GifDecoder {
+ public:
+  enum class Disposal { Unspecified, Keep, Background, Previous };
+
+  explicit GifDecoder(std::vector<char> data);
+  // Whether the given data starts with a GIF header.
+  static auto isGif(const char* data, size_t size) -> bool;
+
+  [[nodiscard]] auto isOk() const -> bool { return !frames.empty(); }
+  [[nodiscard]] auto width() const -> int { return canvas_width; }
+  [[nodiscard]] auto height() const -> int { return canvas_height; }
+  [[nodiscard]] auto frameCount() const -> size_t { return frames.size(); }
+  // The time the given frame is shown for, in milliseconds.
+  [[nodiscard]] auto delay(size_t frame) const -> int;
+  [[nodiscard]] auto disposal(size_t frame) const -> Disposal;
+
+  /* Brings the canvas up to date with the given frame, continuing from the
+   * current frame when moving forward and starting over from the first frame
+   * when moving backward.  Returns false if the frame doesn't exist. */
+  auto composite(size_t frame) -> bool;
+  [[nodiscard]] auto compositedFrame() const -> std::optional<size_t> {
+    return composited;
+  }
+  [[nodiscard]] auto rgb() const -> const std::vector<unsigned char>& {
+    return canvas_rgb;
+  }
+  [[nodiscard]] auto alpha() const -> const std::vector<unsigned char>& {
+    return canvas_alpha;
+  }
+
+ private:
+  struct Frame {
+    int x = 0;
+    int y = 0;
+    int width = 0;
+    int height = 0;
+    int delay_ms = 0;
+    Disposal disposal = Disposal::Unspecified;
+    std::optional<uint8_t> transparent_index;
+    // Offset and color count of the palette within data, which is either the
+    // frame's local palette or the global one.
+    size_t palette_offset = 0;
+    size_t palette_size = 0;
+    bool interlaced = false;
+    uint8_t min_code_size = 0;
+    // Offset of the first sub-block of compressed image data.
+    size_t data_offset = 0;
+  };
+
+  // A copy of the area of the canvas under a frame, to restore once it's
+  // disposed of.
+  struct SavedArea {
+    size_t frame = 0;
+    std::vector<unsigned char> rgb;
+    std::vector<unsigned char> alpha;
+  };
+
+  std::vector<char> data;
+  std::vector<Frame> frames;
+  int canvas_width = 0;
+  int canvas_height = 0;
+  std::vector<unsigned char> canvas_rgb;
+  std::vector<unsigned char> canvas_alpha;
+  std::optional<size_t> composited;
+  std::optional<SavedArea> saved_area;
+
+  [[nodiscard]] auto byte(size_t offset) const -> int;
+  [[nodiscard]] auto word(size_t offset) const -> int;
+  void parse();
+  auto skipSubBlocks(size_t offset) const -> std::optional<size_t>;
+  [[nodiscard]] auto decompress(const Frame& frame) const
+      -> std::vector<uint8_t>;
+  void clearCanvas();
+  void dispose(size_t frame);
+  void draw(size_t frame);
+  void copyArea(const Frame& frame, SavedArea* area, bool restore);
+};
+
+}  // namespace cszb_scoreboard
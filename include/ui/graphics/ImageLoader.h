@@ -0,0 +1,147 @@
+/*
+ui/graphics/ImageLoader.h: Singleton which decodes image files on a small pool
+of background threads, handing the results back on the UI thread.
+
+Copyright 2026 Tracy Beck
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+*/
+
+#pragma once
+
+#include <atomic>              // for atomic
+#include <condition_variable>  // for condition_variable
+#include <cstddef>             // for size_t
+#include <deque>               // for deque
+#include <functional>          // for function
+#include <memory>              // for shared_ptr
+#include <mutex>               // for mutex
+#include <optional>            // for optional
+#include <thread>              // for thread
+#include <utility>             // for move
+#include <vector>              // for vector
+
+#include "ScoreboardCommon.h"     // for PUBLIC_TEST_ONLY
+#include "config/Position.h"      // for Size
+#include "ui/widget/Image.h"      // for Image
+#include "util/FilesystemPath.h"  // for FilesystemPath
+#include "util/Singleton.h"       // for SingletonClass
+
+namespace cszb_scoreboard {
+
+/* Decoding a large image can take long enough to visibly freeze the UI, so
+ * widgets ask this class for images instead of constructing them directly.
+ * Each load returns a Request, which acts as the widget's placeholder for the
+ * image until it's ready.  Completion is always delivered on the UI thread, so
+ * callbacks may touch widgets freely. */
+class ImageLoader {
+ private:
+  struct Job;
+
+ public:
+  // Called on the UI thread with the decoded image (which is not ok if the
+  // file couldn't be read).
+  using Callback = std::function<void(const Image& image)>;
+  // Runs the given task on the UI thread at some later point.
+  using Dispatcher = std::function<void(const std::function<void()>& task)>;
+  // Returns the largest size any image needs to be kept at, if there is one.
+  using SizeLimit = std::function<std::optional<Size>()>;
+
+  /* A handle to a single load.  Only one owner may hold a request, and the load
+   * is canceled when the request is destroyed or replaced, so a widget holding
+   * one as a member never receives a stale or late callback. */
+  class Request {
+   public:
+    Request() = default;
+    Request(const Request&) = delete;
+    Request(Request&& other) noexcept = default;
+    auto operator=(const Request&) -> Request& = delete;
+    auto operator=(Request&& other) noexcept -> Request&;
+    ~Request() { cancel(); }
+
+    // True while the image is still being loaded.
+    [[nodiscard]] auto isPending() const -> bool;
+    [[nodiscard]] auto isReady() const -> bool;
+    // The loaded image, once the request is ready.
+    [[nodiscard]] auto image() const -> std::optional<Image>;
+    void cancel();
+
+   private:
+    friend class ImageLoader;
+    explicit Request(std::shared_ptr<Job> job) : job(std::move(job)) {}
+    std::shared_ptr<Job> job;
+  };
+
+  // GCOVR_EXCL_START - This class uses our singleton objects.  In test, we
+  // always call the constructor that passes in a dispatcher, as there is no
+  // wxApp to dispatch to.
+  explicit ImageLoader(SingletonClass c)
+      : ImageLoader(c, defaultThreadCount(), postToMainThread,
+                    largestDisplaySize) {}
+  // GCOVR_EXCL_STOP
+  ImageLoader(const ImageLoader&) = delete;
+  auto operator=(const ImageLoader&) -> ImageLoader& = delete;
+  ~ImageLoader();
+
+  // Queues the given file to be decoded.  on_loaded may be empty, in which
+  // case the result is only available through the returned request.  Images
+  // larger than the largest display are scaled down to fit it, as there's
+  // nowhere they could be shown any larger.
+  auto load(const FilesystemPath& file, Callback on_loaded = nullptr)
+      -> Request;
+  // As above, but the image is also scaled to fit within fit_size before it's
+  // handed back, so that it's ready to be drawn at that size.
+  auto load(const FilesystemPath& file, const Size& fit_size,
+            Callback on_loaded = nullptr) -> Request;
+
+  PUBLIC_TEST_ONLY
+  ImageLoader(SingletonClass c, size_t threads, Dispatcher dispatcher,
+              SizeLimit size_limit = nullptr);
+
+ private:
+  struct Job {
+    FilesystemPath file;
+    std::optional<Size> fit_size;
+    std::optional<Size> max_size;
+    Callback on_loaded;
+    std::atomic<bool> canceled = false;
+    // Written by the worker before completion is dispatched, and only read on
+    // the UI thread afterwards.
+    std::optional<Image> decoded;
+    // Only accessed on the UI thread.
+    bool ready = false;
+  };
+
+  Dispatcher dispatcher;
+  SizeLimit size_limit;
+  std::mutex mutex;
+  std::condition_variable wake;
+  std::deque<std::shared_ptr<Job>> queue;
+  // Jobs which have been decoded and are waiting to be picked up on the UI
+  // thread.  Workers hand their jobs over through here, rather than to the
+  // dispatched task, so that the last reference to each job (and so its image)
+  // is never dropped on a worker.
+  std::deque<std::shared_ptr<Job>> completed;
+  bool stopping = false;
+  std::vector<std::thread> workers;
+
+  static auto defaultThreadCount() -> size_t;
+  static void postToMainThread(const std::function<void()>& task);
+  static auto largestDisplaySize() -> std::optional<Size>;
+  auto queueJob(std::shared_ptr<Job> job) -> Request;
+  void completeJobs();
+  static void complete(const std::shared_ptr<Job>& job);
+  void work();
+};
+
+}  // namespace cszb_scoreboard
@@ -0,0 +1,61 @@
+/*
+ui/graphics/IndexedFrame.h: A compact copy of an image's pixels, stored as
+indices into a palette of the colors it uses.
+
+Copyright 2026 Tracy Beck
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+*/
+#pragma once
+
+#include <cstddef>   // for size_t
+#include <cstdint>   // for uint8_t
+#include <optional>  // for optional
+#include <vector>    // for vector
+
+namespace cszb_scoreboard {
+
+/* Composited GIF frames rarely use more than 256 distinct colors, so rather
+ * than four bytes per pixel, a frame kept for later can be stored as one byte
+ * per pixel plus a small palette, and expanded again when it's shown.
+ *
+ * Pixels use the same layout as a wxImage: three bytes of RGB per pixel plus a
+ * separate alpha plane.  Fully transparent pixels all share one palette entry,
+ * so their color is not preserved. */
+class IndexedFrame {
+ public:
+  static constexpr size_t MAX_COLORS = 256;
+
+  // Returns nullopt if the pixels use more colors than MAX_COLORS.
+  static auto fromPixels(const unsigned char* rgb, const unsigned char* alpha,
+                         size_t pixel_count) -> std::optional<IndexedFrame>;
+
+  // Writes the pixels back out, to buffers of pixelCount() pixels.
+  void expand(unsigned char* rgb, unsigned char* alpha) const;
+
+  [[nodiscard]] auto pixelCount() const -> size_t { return indices.size(); }
+  [[nodiscard]] auto colorCount() const -> size_t {
+    return palette_alpha.size();
+  }
+  // Memory used by this frame's pixels and palette.
+  [[nodiscard]] auto bytes() const -> size_t;
+
+ private:
+  IndexedFrame() = default;
+
+  std::vector<uint8_t> palette_rgb;
+  std::vector<uint8_t> palette_alpha;
+  std::vector<uint8_t> indices;
+};
+
+}  // namespace cszb_scoreboard
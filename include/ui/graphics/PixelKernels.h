@@ -0,0 +1,63 @@
+/*
+ui/graphics/PixelKernels.h: Bulk per-pixel operations on raw RGB and alpha
+buffers, with SSE2 and AVX2 implementations selected at runtime where the CPU
+supports them.
+
+Copyright 2026 Tracy Beck
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+*/
+#pragma once
+
+#include <cstddef>  // for size_t
+
+#include "ScoreboardCommon.h"  // for PUBLIC_TEST_ONLY
+
+namespace cszb_scoreboard {
+
+/* Buffers are laid out as wxImage stores them: three bytes of RGB per pixel,
+ * and a separate plane of one alpha byte per pixel.  Every operation works on a
+ * run of count contiguous pixels, so callers which work on a sub-rectangle of
+ * an image call them once per row. */
+class PixelKernels {
+ public:
+  enum class Path { Portable, SSE2, AVX2 };
+
+  // Alpha blends a run of foreground pixels over the background, in place.  A
+  // null fg_alpha is treated as fully opaque.  bg_alpha must not be null.
+  static void blend(unsigned char* bg_rgb, unsigned char* bg_alpha,
+                    const unsigned char* fg_rgb, const unsigned char* fg_alpha,
+                    size_t count);
+  // Sets alpha to fully transparent for every pixel matching the given color
+  // and fully opaque for all others.
+  static void maskToAlpha(const unsigned char* rgb, unsigned char* alpha,
+                          size_t count, unsigned char red, unsigned char green,
+                          unsigned char blue);
+  // Lowers any alpha value above max_alpha to max_alpha.
+  static void clampAlpha(unsigned char* alpha, size_t count,
+                         unsigned char max_alpha);
+  // Sets every pixel to the given color.
+  static void tint(unsigned char* rgb, size_t count, unsigned char red,
+                   unsigned char green, unsigned char blue);
+
+  // The implementation chosen for this CPU.
+  static auto path() -> Path;
+
+  PUBLIC_TEST_ONLY
+  static auto isSupported(Path path) -> bool;
+  // Forces every later call onto the given implementation, which must be
+  // supported.
+  static void usePath(Path path);
+};
+
+}  // namespace cszb_scoreboard
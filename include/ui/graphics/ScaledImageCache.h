@@ -0,0 +1,86 @@
+/*
+ui/graphics/ScaledImageCache.h: Singleton which holds recently scaled copies of
+images, so that every screen showing an image at a given size shares one copy.
+
+Copyright 2026 Tracy Beck
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+*/
+
+#pragma once
+
+#include <wx/image.h>  // for wxImageResizeQuality, wxIMAGE_QUALITY_NORMAL
+
+#include <cstddef>  // for size_t
+#include <cstdint>  // for uint64_t, int64_t
+
+#include "ScoreboardCommon.h"  // for PUBLIC_TEST_ONLY
+#include "config/Position.h"   // for Size
+#include "ui/widget/Image.h"   // for Image
+#include "util/LruCache.h"     // for LruCache
+#include "util/Singleton.h"    // for SingletonClass
+
+namespace cszb_scoreboard {
+
+/* The same image is often on screen in many places at once (each presenter,
+ * its preview and thumbnail, and any quick states holding it), and usually at
+ * only a handful of sizes.  Rather than each of them scaling their own copy,
+ * they ask this cache, which keeps the most recently used copies up to a
+ * memory budget set in the general settings. */
+class ScaledImageCache {
+ public:
+  static constexpr size_t BYTES_PER_MEGABYTE = 1024 * 1024;
+
+  // GCOVR_EXCL_START - This class uses our singleton objects.  In test, we
+  // always call the constructor that passes in the budget directly.
+  explicit ScaledImageCache(SingletonClass c)
+      : ScaledImageCache(c, configuredBudget()) {}
+  // GCOVR_EXCL_STOP
+
+  // Returns image scaled to fit within target_size (see Image::scaledToFit),
+  // reusing an earlier copy of the same image at the same size if there is one.
+  auto scaledToFit(const Image& image, const Size& target_size,
+                   wxImageResizeQuality quality = wxIMAGE_QUALITY_NORMAL)
+      -> Image;
+  // Sets the most memory, in bytes, which scaled images may occupy before the
+  // least recently used ones are dropped.
+  void setBudget(size_t bytes) { cache.setCapacity(bytes); }
+  [[nodiscard]] auto budget() const -> size_t { return cache.capacity(); }
+  // Memory, in bytes, currently used by the cached images.
+  [[nodiscard]] auto usage() const -> size_t { return cache.cost(); }
+  [[nodiscard]] auto size() const -> size_t { return cache.size(); }
+
+  PUBLIC_TEST_ONLY
+  ScaledImageCache(SingletonClass c, size_t budget_bytes)
+      : cache(budget_bytes) {}
+
+ private:
+  struct Key {
+    uint64_t content_id;
+    int64_t width;
+    int64_t height;
+    wxImageResizeQuality quality;
+
+    auto operator==(const Key& rhs) const -> bool = default;
+  };
+  struct KeyHash {
+    auto operator()(const Key& key) const -> size_t;
+  };
+
+  LruCache<Key, Image, KeyHash> cache;
+
+  static auto configuredBudget() -> size_t;
+  static auto imageBytes(const Image& image) -> size_t;
+};
+
+}  // namespace cszb_scoreboard
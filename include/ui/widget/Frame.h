@@ -82,6 +82,12 @@ class Frame : public Widget {
   void setStatusBar(const wxString& text);
   auto show(bool show) -> bool { return _wx->Show(show); }
   virtual void refreshWindow() { _wx->Refresh(); }
+  // Refreshes only the animated content of this frame which has changed since
+  // it was last painted, returning the time (on the AnimationClock) at which
+  // there will next be a change to refresh, if ever.
+  virtual auto refreshAnimations(int64_t now) -> std::optional<int64_t> {
+    return std::nullopt;
+  }
   void updateWindow() { _wx->Update(); }
   void closeWindow() { _wx->Close(true); }
 
@@ -19,11 +19,13 @@ limitations under the License.
 
 #pragma once
 
-#include <stdint.h>     // for int64_t
+#include <stdint.h>     // for int64_t, uint64_t
 #include <wx/bitmap.h>  // for wxBitmap
 
-#include <memory>  // for shared_ptr
-#include <vector>  // for vector
+#include <cstddef>   // for size_t
+#include <memory>    // for shared_ptr
+#include <optional>  // for optional
+#include <vector>    // for vector
 
 #include "config/Position.h"   // for Size
 #include "config/swx/image.h"  // for Image
@@ -44,7 +46,11 @@ class Image {
   explicit Image(const wxImage& img) : _wx(img) {}
   explicit Image(const ::cszb_scoreboard::Size& sz, bool clear = true);
   explicit Image(const wxBitmap& bmp) : _wx(bmp) {}
-  explicit Image(const FilesystemPath& file);
+  // Loads the given file.  If max_size is given, an image larger than it is
+  // scaled down to fit within it; otherwise it's kept at full resolution.
+  explicit Image(const FilesystemPath& file,
+                 const std::optional<::cszb_scoreboard::Size>& max_size =
+                     std::nullopt);
   explicit Image(const std::vector<char>& bin_data);
 
   // Custom methods
@@ -54,8 +60,25 @@ class Image {
   // Animation methods
   [[nodiscard]] auto isAnimated() const -> bool;
   [[nodiscard]] auto animate(int64_t current_time_ms) const -> wxImage;
+  [[nodiscard]] auto frameIndex(int64_t current_time_ms) const -> size_t;
+  [[nodiscard]] auto nextFrameChange(int64_t after_ms) const
+      -> std::optional<int64_t>;
+
+  // Rendering methods
+  [[nodiscard]] auto bitmap() const -> wxBitmap;
+  [[nodiscard]] auto bitmap(int64_t current_time_ms) const -> wxBitmap;
+  // Identifies this image's content.  Copies share it, and it changes
+  // whenever the image is modified, so caches of anything derived from an
+  // image may key on it.  Still images decoded from identical files share an
+  // ID as well.
+  [[nodiscard]] auto contentId() const -> uint64_t { return _content_id; }
   auto rescale(int width, int height,
                wxImageResizeQuality quality = wxIMAGE_QUALITY_NORMAL) -> Image&;
+  // A copy of this image, scaled to the largest size which fits within
+  // target_size without changing its aspect ratio.
+  [[nodiscard]] auto scaledToFit(
+      const ::cszb_scoreboard::Size& target_size,
+      wxImageResizeQuality quality = wxIMAGE_QUALITY_NORMAL) const -> Image;
 
   // Wrapped swx::Image methods (cased to standard style)
   [[nodiscard]] auto isOk() const -> bool;
@@ -74,12 +97,32 @@ class Image {
   [[nodiscard]] auto wx() -> wxImage& { return _wx; }
 
  private:
+  // Device-dependent bitmaps converted from this image, created on first draw
+  // and shared with any copies made afterwards until one of them is modified.
+  // Only the most recently drawn animation frame is retained.
+  struct BitmapCache {
+    wxBitmap still;
+    std::optional<size_t> frame_index;
+    wxBitmap frame;
+  };
+  // The decoder for an animated image, shared by all copies of it.
+  struct Animation;
+
   swx::Image _wx;
-  std::shared_ptr<std::vector<wxImage>> frames;
-  std::shared_ptr<std::vector<int>> delays;
+  std::shared_ptr<Animation> animation;
+  // Animation frames are composited at their original size, and scaled to
+  // this size as they are shown if the image has been rescaled.
+  std::optional<::cszb_scoreboard::Size> frame_size;
+  wxImageResizeQuality frame_quality = wxIMAGE_QUALITY_NORMAL;
   int64_t start_time = 0;
-
-  void loadAnimation(const FilesystemPath& file);
+  uint64_t _content_id = nextContentId();
+  mutable std::shared_ptr<BitmapCache> bitmaps;
+
+  static auto nextContentId() -> uint64_t;
+  void load(const char* data, size_t size,
+            const std::optional<::cszb_scoreboard::Size>& max_size);
+  auto shrinkToFit(const ::cszb_scoreboard::Size& max_size) -> bool;
+  void modified();
 };
 
 }  // namespace cszb_scoreboard
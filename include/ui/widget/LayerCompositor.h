@@ -0,0 +1,106 @@
+/*
+ui/widget/LayerCompositor.h: Retains a stack of rendered layers in an
+off-screen bitmap, so that painting only re-rasterizes the layers whose inputs
+have changed since the previous paint.
+
+Copyright 2026 Tracy Beck
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+*/
+
+#pragma once
+
+#include <wx/bitmap.h>  // for wxBitmap
+
+#include <cstddef>     // for size_t
+#include <functional>  // for function
+#include <optional>    // for optional
+#include <string>      // for string
+#include <vector>      // for vector
+
+#include "config/Position.h"  // for Position, Size
+#include "wx/gdicmn.h"        // for wxRect
+
+namespace cszb_scoreboard {
+class RenderContext;
+
+class LayerCompositor {
+ public:
+  using LayerRenderer = std::function<void(RenderContext*)>;
+  struct Bounds {
+    Position origin;
+    Size size;
+  };
+
+  explicit LayerCompositor(size_t layer_count);
+
+  /* Marks a layer as needing to be re-rendered on the next composite.  Every
+   * layer above it is re-rendered as well, as it is drawn on top of the changed
+   * layer. */
+  void invalidate(size_t layer);
+  void invalidateAll();
+  /* Records an opaque description of inputs which are polled at paint time
+   * (the current timer text, an animation frame, etc.) and invalidates the
+   * layer if it differs from the one used for the last render. */
+  void setStamp(size_t layer, const std::string& stamp);
+  /* Records the area a layer was last drawn within.  Once a layer has bounds, a
+   * change to its stamp only re-renders that area of the backing bitmap,
+   * rather than all of it.  Bounds are expected to be set while rendering. */
+  void setBounds(size_t layer, const Position& origin, const Size& size);
+  [[nodiscard]] auto bounds(size_t layer) const -> std::optional<Bounds>;
+  /* Brings the backing bitmap up to date, rendering each dirty layer with the
+   * matching entry of renderers (bottom-most first), then blits the result to
+   * the given renderer. */
+  void composite(RenderContext* renderer, const Size& size,
+                 const std::vector<LayerRenderer>& renderers);
+
+ private:
+  struct Layer {
+    bool dirty = true;
+    // Whether the layer itself changed in the last composite, rather than only
+    // being redrawn on top of a change beneath it.
+    bool changed = true;
+    std::string stamp;
+    std::optional<Bounds> bounds;
+  };
+
+  std::vector<Layer> layers;
+  wxBitmap frame;
+  Size frame_size;
+  // The composite of the bottom snapshot_layers layers, so that a change to
+  // the layers above (such as a running timer) can skip re-rendering them.
+  // Only one snapshot is kept, so a side costs at most two bitmaps.  It's
+  // taken at the highest boundary whose layers beneath have held still for a
+  // composite, so it stays below a layer which changes on every frame (such as
+  // an animated overlay) rather than being redrawn with it.  Its bitmap is kept
+  // when the snapshot goes stale, to be redrawn in place.
+  wxBitmap snapshot;
+  size_t snapshot_layers = 0;
+  bool snapshot_valid = false;
+  // The area of the backing bitmap which needs to be re-rendered, if it is
+  // only part of it.
+  std::optional<wxRect> damage;
+  bool full_damage = true;
+
+  [[nodiscard]] auto firstDirtyLayer() const -> std::optional<size_t>;
+  [[nodiscard]] auto heldStill(size_t first, size_t last) const -> bool;
+  void markDirty(size_t layer);
+  void updateSnapshot(size_t first_dirty,
+                      const std::vector<LayerRenderer>& renderers);
+  void renderLayers(wxBitmap* target, size_t first, size_t last,
+                    const std::vector<LayerRenderer>& renderers,
+                    const std::optional<wxRect>& clip,
+                    bool over_existing = false) const;
+};
+
+}  // namespace cszb_scoreboard
@@ -39,6 +39,9 @@ class PersistentTimer {
 
  public:
   PersistentTimer(int period, const std::function<void()>& on_tick);
+  // Creates a timer which does not run until start is called.
+  explicit PersistentTimer(const std::function<void()>& on_tick);
+  void start(int period, bool one_shot = false);
   void stop();
 
   PUBLIC_TEST_ONLY
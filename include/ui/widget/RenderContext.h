@@ -23,11 +23,13 @@ limitations under the License.
 #include <functional>  // for function
 #include <memory>      // for unique_ptr
 #include <string>      // for string
+#include <vector>      // for vector
 
 #include "config/Position.h"         // for Size
 #include "ui/widget/swx/ClientDC.h"  // for ClientDC
 #include "ui/widget/swx/PaintDC.h"   // for PaintDC
 
+class wxBitmap;
 class wxDC;
 class wxWindow;
 
@@ -51,21 +53,31 @@ class RenderContext {
   };
 
  public:
+  // A single line of a block of text, with its extent in the current font.
+  struct TextLine {
+    std::string text;
+    Size extent;
+  };
+
   explicit RenderContext(Token t) {}
   static auto forEvent(wxWindow* wx) -> std::unique_ptr<RenderContext>;
   static auto forWidget(wxWindow* wx) -> std::unique_ptr<RenderContext>;
   static auto forDC(wxDC* dc) -> std::unique_ptr<RenderContext>;
 
   void clear(const Color& color);
+  void drawBitmap(const wxBitmap& bitmap, int64_t x, int64_t y);
   void drawImage(const Image& image, int64_t x, int64_t y, bool use_mask = true,
                  bool animate = true);
   void drawLine(const Position& start, const Position& end);
   void drawText(const std::string& text, int64_t x, int64_t y);
+  // Draws lines as previously measured by textLines, one below the other.
+  void drawTextLines(const std::vector<TextLine>& lines, int64_t x, int64_t y);
   void setFont(const proto::Font& font, const Size& font_size);
   void setPen(const Color& color, int width = 1);
   void setTextColor(const Color& color);
   void textExtent(const std::string& text, int* width, int* height);
   auto textExtent(const std::string& text) -> Size;
+  auto textLines(const std::string& text) -> std::vector<TextLine>;
 
  private:
   // Any initialization of either of these objects should ensure that the other
@@ -75,6 +87,7 @@ class RenderContext {
   std::unique_ptr<swx::PaintDC> event_context;
   wxDC* raw_context = nullptr;
 
+  auto activeContext() -> wxDC*;
   void runAgainstActiveContext(const std::function<void(wxDC*)>& lambda);
 };
 
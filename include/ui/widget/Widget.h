@@ -24,9 +24,10 @@ limitations under the License.
 #include <memory>      // for make_shared, shared_ptr
 
 #include "ScoreboardCommon.h"  // for DEFAULT_BORDER_SIZE
-#include "config/Position.h"   // for Size
+#include "config/Position.h"   // for Position, Size
 #include "config/swx/defs.h"   // for operator|, wxDirection, wxStretch, wxS...
 #include "config/swx/event.h"  // for wxEventTypeTag, wxCloseEvent, wxComman...
+#include "wx/gdicmn.h"         // for wxRect
 #include "wx/window.h"         // for wxWindow
 
 namespace cszb_scoreboard {
@@ -103,6 +104,11 @@ class Widget {
   void hide() const { wx()->Hide(); }
   void show() const { wx()->Show(); }
   virtual void refresh() const { wx()->Refresh(); }
+  // Repaints only the given area of this widget.
+  void refreshRect(const Position& origin, const Size& size) const {
+    wx()->RefreshRect(wxRect(origin.toWx(), size.toWx()),
+                      /*eraseBackground=*/false);
+  }
   [[nodiscard]] auto hidden() const -> bool { return !wx()->IsShown(); }
   [[nodiscard]] auto backgroundColor() const -> Color;
   [[nodiscard]] auto relativeVerticalCenter(const Widget& relative_to) const
@@ -0,0 +1,40 @@
+/*
+util/AnimationClock.h: Utilities for scheduling repaints of animated content
+against a single monotonic clock.
+
+Copyright 2026 Tracy Beck
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+*/
+#pragma once
+
+#include <cstdint>   // for int64_t
+#include <optional>  // for optional
+
+namespace cszb_scoreboard {
+
+// All animation deadlines are expressed as milliseconds on the steady clock, as
+// returned by now().
+class AnimationClock {
+ public:
+  static auto now() -> int64_t;
+  // Converts a timestamp in milliseconds on the system (wall) clock to the
+  // steady clock, for state which is tracked against wall time.
+  static auto fromSystemMillis(int64_t system_millis) -> int64_t;
+  static auto toSystemMillis(int64_t steady_millis) -> int64_t;
+  // Returns the earlier of two optional deadlines, or whichever one is set.
+  static auto earliest(std::optional<int64_t> a, std::optional<int64_t> b)
+      -> std::optional<int64_t>;
+};
+
+}  // namespace cszb_scoreboard
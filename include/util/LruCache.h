@@ -0,0 +1,111 @@
+/*
+util/LruCache.h: A bounded key/value cache which evicts the least recently used
+entries once its capacity is exceeded.
+
+Copyright 2026 Tracy Beck
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+*/
+#pragma once
+
+#include <cstddef>        // for size_t
+#include <functional>     // for hash, equal_to
+#include <list>           // for list, operator!=, _List_iterator
+#include <unordered_map>  // for unordered_map
+#include <utility>        // for move
+
+namespace cszb_scoreboard {
+
+/* Each entry carries a cost (1 by default), and the capacity is a limit on the
+ * total cost of all entries, so the same cache can be bounded either by a
+ * count of entries or by, say, bytes of memory. */
+template <typename Key, typename Value, typename Hash = std::hash<Key>,
+          typename KeyEqual = std::equal_to<Key>>
+class LruCache {
+ public:
+  explicit LruCache(size_t capacity) : max_cost(capacity) {}
+
+  // Returns the cached value for key, marking it as the most recently used, or
+  // nullptr if there is none.  The pointer is invalidated by any later insert,
+  // erase or clear.
+  auto find(const Key& key) -> Value* {
+    auto index_entry = index.find(key);
+    if (index_entry == index.end()) {
+      return nullptr;
+    }
+    entries.splice(entries.begin(), entries, index_entry->second);
+    return &index_entry->second->value;
+  }
+
+  // Adds or replaces the value for key, then evicts the least recently used
+  // entries until the cache is back within its capacity.  The entry just added
+  // is never evicted, even if it is larger than the capacity on its own.
+  auto insert(const Key& key, Value value, size_t cost = 1) -> Value* {
+    erase(key);
+    entries.push_front(Entry{key, std::move(value), cost});
+    index.emplace(key, entries.begin());
+    total_cost += cost;
+    evict();
+    return &entries.front().value;
+  }
+
+  void erase(const Key& key) {
+    auto index_entry = index.find(key);
+    if (index_entry == index.end()) {
+      return;
+    }
+    total_cost -= index_entry->second->cost;
+    entries.erase(index_entry->second);
+    index.erase(index_entry);
+  }
+
+  void clear() {
+    index.clear();
+    entries.clear();
+    total_cost = 0;
+  }
+
+  void setCapacity(size_t capacity) {
+    max_cost = capacity;
+    evict();
+  }
+
+  [[nodiscard]] auto capacity() const -> size_t { return max_cost; }
+  [[nodiscard]] auto cost() const -> size_t { return total_cost; }
+  [[nodiscard]] auto size() const -> size_t { return entries.size(); }
+
+ private:
+  struct Entry {
+    Key key;
+    Value value;
+    size_t cost;
+  };
+
+  // Most recently used entries are at the front.
+  std::list<Entry> entries;
+  std::unordered_map<Key, typename std::list<Entry>::iterator, Hash, KeyEqual>
+      index;
+  size_t max_cost;
+  size_t total_cost = 0;
+
+  void evict() {
+    while (total_cost > max_cost && entries.size() > 1) {
+      const Entry& oldest = entries.back();
+      total_cost -= oldest.cost;
+      index.erase(oldest.key);
+      entries.pop_back();
+    }
+  }
+};
+
+}  // namespace cszb_scoreboard
@@ -0,0 +1,54 @@
+/*
+util/MappedFile.h: Read-only access to the contents of a file, memory-mapped
+where the platform allows it.
+
+Copyright 2026 Tracy Beck
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+*/
+#pragma once
+
+#include <cstddef>  // for size_t
+#include <vector>   // for vector
+
+namespace cszb_scoreboard {
+class FilesystemPath;
+
+/* The file is mapped for as long as this object exists, which on Windows also
+ * prevents it from being renamed or deleted, so it's meant to be held only
+ * while the contents are being decoded.  If the file can't be mapped (an empty
+ * file, or a filesystem which doesn't support it), it is read into memory
+ * instead. */
+class MappedFile {
+ public:
+  explicit MappedFile(const FilesystemPath& path);
+  MappedFile(const MappedFile&) = delete;
+  auto operator=(const MappedFile&) -> MappedFile& = delete;
+  ~MappedFile();
+
+  [[nodiscard]] auto isOk() const -> bool { return ok; }
+  [[nodiscard]] auto data() const -> const char* { return contents; }
+  [[nodiscard]] auto size() const -> size_t { return length; }
+
+ private:
+  bool ok = false;
+  const char* contents = nullptr;
+  size_t length = 0;
+  void* view = nullptr;
+  std::vector<char> buffer;
+
+  void map(const FilesystemPath& path);
+  void read(const FilesystemPath& path);
+};
+
+}  // namespace cszb_scoreboard
@@ -0,0 +1,144 @@
+/*
+util/NgramIndex.h: An index of short substrings, used to quickly find the
+strings which might contain a given search string.
+
+Copyright 2026 Tracy Beck
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+*/
+#pragma once
+
+#include <algorithm>      // for lower_bound, set_intersection, sort, unique
+#include <cstddef>        // for size_t
+#include <cstdint>        // for uint32_t
+#include <functional>     // for less
+#include <iterator>       // for back_inserter
+#include <string>         // for string
+#include <unordered_map>  // for unordered_map
+#include <utility>        // for move
+#include <vector>         // for vector
+
+namespace cszb_scoreboard {
+
+/* Every string added is broken into each run of up to GRAM_LENGTH characters
+ * it contains, and each id is listed under the runs of its string.  A string
+ * can then only contain a query if it contains every run of the query, so the
+ * lists for those runs are intersected instead of searching every string.
+ *
+ * Strings are matched byte for byte, so callers wanting case-insensitive
+ * matches should add and query lowercase strings. */
+template <typename Id, typename Compare = std::less<Id>>
+class NgramIndex {
+ public:
+  static constexpr size_t GRAM_LENGTH = 3;
+
+  void insert(const std::string& text, Id id) {
+    for (Gram gram : grams(text)) {
+      std::vector<Id>& ids = postings[gram];
+      ids.insert(std::lower_bound(ids.begin(), ids.end(), id, Compare()), id);
+    }
+  }
+
+  // Removes an id added with the same text.
+  void erase(const std::string& text, const Id& id) {
+    for (Gram gram : grams(text)) {
+      auto posting = postings.find(gram);
+      if (posting == postings.end()) {
+        continue;
+      }
+      std::vector<Id>& ids = posting->second;
+      auto existing = std::lower_bound(ids.begin(), ids.end(), id, Compare());
+      if (existing != ids.end() && !Compare()(id, *existing)) {
+        ids.erase(existing);
+      }
+      if (ids.empty()) {
+        postings.erase(posting);
+      }
+    }
+  }
+
+  void clear() { postings.clear(); }
+
+  // Returns, in sorted order, the ids of every string which may contain query,
+  // which must not be empty.  Queries no longer than GRAM_LENGTH are answered
+  // exactly, but longer ones may also return strings which contain each of
+  // its runs without containing the whole query, so should be checked.
+  [[nodiscard]] auto candidates(const std::string& query) const
+      -> std::vector<Id> {
+    if (query.length() <= GRAM_LENGTH) {
+      auto posting = postings.find(gram(query, 0, query.length()));
+      if (posting == postings.end()) {
+        return {};
+      }
+      return posting->second;
+    }
+
+    std::vector<const std::vector<Id>*> lists;
+    for (size_t start = 0; start + GRAM_LENGTH <= query.length(); ++start) {
+      auto posting = postings.find(gram(query, start, GRAM_LENGTH));
+      if (posting == postings.end()) {
+        return {};
+      }
+      lists.push_back(&posting->second);
+    }
+    // Starting from the shortest list keeps every intersection small.
+    std::sort(lists.begin(), lists.end(),
+              [](const std::vector<Id>* a, const std::vector<Id>* b) -> bool {
+                return a->size() < b->size();
+              });
+    std::vector<Id> matches = *lists.front();
+    for (size_t i = 1; i < lists.size() && !matches.empty(); ++i) {
+      std::vector<Id> narrowed;
+      std::set_intersection(matches.begin(), matches.end(), lists[i]->begin(),
+                            lists[i]->end(), std::back_inserter(narrowed),
+                            Compare());
+      matches = std::move(narrowed);
+    }
+    return matches;
+  }
+
+ private:
+  // Up to three bytes of text, plus the number of bytes, packed together.
+  using Gram = uint32_t;
+
+  std::unordered_map<Gram, std::vector<Id>> postings;
+
+  static auto gram(const std::string& text, size_t start, size_t length)
+      -> Gram {
+    // NOLINTBEGIN(readability-magic-numbers)
+    Gram packed = static_cast<Gram>(length) << 24;
+    for (size_t i = 0; i < length; ++i) {
+      packed |= static_cast<Gram>(static_cast<unsigned char>(text[start + i]))
+                << (16 - 8 * i);
+    }
+    // NOLINTEND(readability-magic-numbers)
+    return packed;
+  }
+
+  // Every distinct run of one to GRAM_LENGTH bytes in text.
+  static auto grams(const std::string& text) -> std::vector<Gram> {
+    std::vector<Gram> found;
+    for (size_t start = 0; start < text.length(); ++start) {
+      for (size_t length = 1;
+           length <= GRAM_LENGTH && start + length <= text.length();
+           ++length) {
+        found.push_back(gram(text, start, length));
+      }
+    }
+    std::sort(found.begin(), found.end());
+    found.erase(std::unique(found.begin(), found.end()), found.end());
+    return found;
+  }
+};
+
+}  // namespace cszb_scoreboard
@@ -33,7 +33,9 @@ class FrameManager;
 class GeneralConfig;
 class HotkeyTable;
 class ImageLibrary;
+class ImageLoader;
 class Persistence;
+class ScaledImageCache;
 class SlideShow;
 class TeamColors;
 class TeamConfig;
@@ -60,7 +62,9 @@ class Singleton {
   virtual auto frameManager() -> FrameManager* = 0;
   virtual auto hotkeyTable() -> HotkeyTable* = 0;
   virtual auto imageLibrary() -> ImageLibrary* = 0;
+  virtual auto imageLoader() -> ImageLoader* = 0;
   virtual auto persistence() -> Persistence* = 0;
+  virtual auto scaledImageCache() -> ScaledImageCache* = 0;
   virtual auto slideShow() -> SlideShow* = 0;
   virtual auto teamColors() -> TeamColors* = 0;
   virtual auto teamConfig() -> TeamConfig* = 0;
@@ -81,7 +85,9 @@ class SingletonImpl : public Singleton {
   auto generalConfig() -> GeneralConfig* override;
   auto hotkeyTable() -> HotkeyTable* override;
   auto imageLibrary() -> ImageLibrary* override;
+  auto imageLoader() -> ImageLoader* override;
   auto persistence() -> Persistence* override;
+  auto scaledImageCache() -> ScaledImageCache* override;
   auto slideShow() -> SlideShow* override;
   auto teamColors() -> TeamColors* override;
   auto teamConfig() -> TeamConfig* override;
@@ -102,7 +108,9 @@ class SingletonImpl : public Singleton {
   GeneralConfig* inst_general_config = nullptr;
   HotkeyTable* inst_hotkey_table = nullptr;
   ImageLibrary* inst_image_library = nullptr;
+  ImageLoader* inst_image_loader = nullptr;
   Persistence* inst_persistence = nullptr;
+  ScaledImageCache* inst_scaled_image_cache = nullptr;
   SlideShow* inst_slide_show = nullptr;
   TeamColors* inst_team_colors = nullptr;
   TeamConfig* inst_team_config = nullptr;
@@ -19,9 +19,10 @@ limitations under the License.
 
 #pragma once
 
-#include <chrono>   // IWYU pragma: keep for seconds
-#include <cstdint>  // for int64_t
-#include <string>   // for string
+#include <chrono>    // IWYU pragma: keep for seconds
+#include <cstdint>   // for int64_t
+#include <optional>  // for optional
+#include <string>    // for string
 
 #include "ScoreboardCommon.h"  // for PUBLIC_TEST_ONLY
 #include "util/Singleton.h"    // for Singleton, SingletonClass
@@ -40,6 +41,10 @@ class TimerManager {
   [[nodiscard]] auto timerOn() const -> bool { return timer_displayed; }
   [[nodiscard]] auto timerRunning() const -> bool { return timer_running; }
   auto displayTime() -> std::string;
+  // Returns the first time after after_millis (on the AnimationClock) at which
+  // displayTime() will change, or nullopt if it will not change on its own.
+  [[nodiscard]] auto nextDisplayChange(int64_t after_millis) const
+      -> std::optional<int64_t>;
   void setTime(int64_t seconds);
   void startTimer();
   void pauseTimer();
@@ -51,6 +56,8 @@ class TimerManager {
 
  private:
   auto timeLeft() -> std::chrono::seconds;
+  void wakeRefreshTimer();
+  void requestRefresh();
 
   bool timer_displayed;
   bool timer_running;
@@ -21,11 +21,12 @@ limitations under the License.
 
 #include <google/protobuf/util/message_differencer.h>  // for MessageDiffere...
 
-#include <cassert>  // for assert
-#include <cstdint>  // for uint32_t
+#include <algorithm>  // for max
+#include <cassert>    // for assert
+#include <cstdint>    // for uint32_t
 
 #include "config/Persistence.h"     // for Persistence
-#include "config/Position.h"        // for Position
+#include "config/Position.h"        // for Position, Size
 #include "ui/frame/FrameManager.h"  // for FrameManager
 #include "ui/frame/MainView.h"      // for MainView
 #include "ui/widget/Display.h"      // for Display
@@ -187,6 +188,20 @@ auto DisplayConfig::displayDetails(int index) -> proto::DisplayInfo {
   return display_config.displays(index);
 }
 
+auto DisplayConfig::largestDisplaySize() -> std::optional<Size> {
+  if (display_config.displays_size() == 0) {
+    return std::nullopt;
+  }
+  Size largest{.width = 0, .height = 0};
+  for (const auto& display : display_config.displays()) {
+    largest.width =
+        std::max<int64_t>(largest.width, display.dimensions().width());
+    largest.height =
+        std::max<int64_t>(largest.height, display.dimensions().height());
+  }
+  return largest;
+}
+
 // Determines which display currently houses the main control window.
 auto DisplayConfig::isPrimaryDisplay(proto::DisplayInfo* display_info) -> bool {
   Frame* main_view = singleton->frameManager()->mainView();
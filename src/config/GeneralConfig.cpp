@@ -23,6 +23,8 @@ limitations under the License.
 
 namespace cszb_scoreboard {
 
+constexpr int32_t DEFAULT_IMAGE_CACHE_MEGABYTES = 256;
+
 GeneralConfig::GeneralConfig(SingletonClass c, Singleton* singleton) {
   this->singleton = singleton;
   general_config = singleton->persistence()->loadGeneralConfig();
@@ -43,6 +45,10 @@ auto GeneralConfig::checkGeneralConfig() -> bool {
     general_config.set_drop_shadow_depth(-1);
     config_updated = true;
   }
+  if (general_config.image_cache_megabytes() <= 0) {
+    general_config.set_image_cache_megabytes(DEFAULT_IMAGE_CACHE_MEGABYTES);
+    config_updated = true;
+  }
 
   return config_updated;
 }
@@ -55,6 +61,14 @@ void GeneralConfig::setDropShadowDistance(double distance) {
   general_config.set_drop_shadow_depth(distance);
 }
 
+auto GeneralConfig::imageCacheMegabytes() -> int32_t {
+  return general_config.image_cache_megabytes();
+}
+
+void GeneralConfig::setImageCacheMegabytes(int32_t megabytes) {
+  general_config.set_image_cache_megabytes(megabytes);
+}
+
 void GeneralConfig::saveSettings() {
   singleton->persistence()->saveGeneralConfig(general_config);
 }
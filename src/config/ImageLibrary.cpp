@@ -19,12 +19,15 @@ limitations under the License.
 
 #include "config/ImageLibrary.h"
 
-#include <algorithm>      // for binary_search, find, lower_bound
+#include <algorithm>      // for lower_bound, upper_bound, sort, unique, set...
 #include <array>          // for array
 #include <cctype>         // for tolower
 #include <compare>        // for operator<
-#include <cstdint>        // for uint32_t
+#include <cstdint>        // for uint32_t, int64_t
 #include <filesystem>     // for operator==, path
+#include <iterator>       // for back_inserter, next
+#include <optional>       // for optional
+#include <unordered_map>  // for unordered_map
 #include <unordered_set>  // for unordered_set, operator==, _Node_it...
 #include <utility>        // for move
 
@@ -38,19 +41,60 @@ limitations under the License.
 namespace cszb_scoreboard {
 
 constexpr uint32_t MAXIMUM_DIRECTORY_CRAWL_DEPTH = 10;
+// Enough to page back and forth between a few searches while typing.
+constexpr size_t CACHED_SEARCHES = 16;
+
+// Adds one use of a string by the image at position, keeping uses sorted.
+static void insertPosition(std::vector<size_t>* positions, size_t position) {
+  positions->insert(
+      std::upper_bound(positions->begin(), positions->end(), position),
+      position);
+}
+
+// Removes one use of a string by the image at position, if there is one.
+static void removePosition(std::vector<size_t>* positions, size_t position) {
+  auto existing =
+      std::lower_bound(positions->begin(), positions->end(), position);
+  if (existing != positions->end() && *existing == position) {
+    positions->erase(existing);
+  }
+}
+
+// Sorts positions, dropping any duplicates.
+static void sortUnique(std::vector<size_t>* positions) {
+  std::sort(positions->begin(), positions->end());
+  positions->erase(std::unique(positions->begin(), positions->end()),
+                   positions->end());
+}
 
-// Simple helper method which will insert a string into a sorted vector of
-// strings, ignoring it if it's a duplicate.
-void insertIntoSortedVector(std::vector<CaseOptionalString>* vect,
-                            const std ::string& entry) {
-  auto wrapped_entry = CaseOptionalString(entry);
-  auto existing_element =
-      std::lower_bound(vect->begin(), vect->end(), wrapped_entry);
-  if (existing_element == vect->end() || *existing_element != wrapped_entry) {
-    auto insertion_point =
-        std::upper_bound(vect->begin(), vect->end(), wrapped_entry);
-    vect->insert(insertion_point, wrapped_entry);
+// Moves every use in positions to the new place of its image, dropping uses by
+// images which were removed (which have no new place).
+// Positions stay sorted, as images never change order when others are removed.
+static void remapPositions(std::vector<size_t>* positions,
+                           const std::vector<std::optional<size_t>>& moved) {
+  auto kept = positions->begin();
+  for (size_t position : *positions) {
+    if (moved[position].has_value()) {
+      *kept++ = *moved[position];
+    }
   }
+  positions->erase(kept, positions->end());
+}
+
+// The form of a path used to look up images, in which any run of separators is
+// a single '/', so that paths std::filesystem treats as equal share a key.
+static auto pathKey(const std::string& path) -> std::string {
+  std::string key;
+  key.reserve(path.length());
+  for (char c : path) {
+    bool separator = c == '/' || c == FilesystemPath::preferred_separator;
+    if (!separator) {
+      key.push_back(c);
+    } else if (key.empty() || key.back() != '/') {
+      key.push_back('/');
+    }
+  }
+  return key;
 }
 
 // GCOVR_EXCL_START - This class uses our singleton objects.  In test, we
@@ -63,9 +107,120 @@ ImageLibrary::ImageLibrary(SingletonClass c)
 // GCOVR_EXCL_STOP
 
 ImageLibrary::ImageLibrary(SingletonClass c, Singleton* singleton,
-                           proto::ImageLibrary library) {
+                           proto::ImageLibrary library)
+    : search_cache(CACHED_SEARCHES) {
   this->singleton = singleton;
   this->library = std::move(library);
+  rebuildIndex();
+}
+
+auto ImageLibrary::internTag(const std::string& value) -> TagId {
+  CaseOptionalString tag(value);
+  auto existing = tag_ids.find(tag);
+  if (existing != tag_ids.end()) {
+    return existing->second;
+  }
+  TagId id;
+  if (free_tag_ids.empty()) {
+    id = static_cast<TagId>(tag_entries.size());
+    tag_entries.push_back(TagEntry{.tag = tag});
+  } else {
+    id = free_tag_ids.back();
+    free_tag_ids.pop_back();
+    tag_entries[id] = TagEntry{.tag = tag};
+  }
+  tag_ids.emplace(tag, id);
+  tag_grams.insert(tag.lower(), id);
+  return id;
+}
+
+void ImageLibrary::addUse(TagId id, std::vector<size_t> TagEntry::*uses,
+                          size_t position) {
+  insertPosition(&(tag_entries[id].*uses), position);
+}
+
+void ImageLibrary::removeUse(TagId id, std::vector<size_t> TagEntry::*uses,
+                             size_t position) {
+  TagEntry& entry = tag_entries[id];
+  removePosition(&(entry.*uses), position);
+  if (entry.named.empty() && entry.tagged.empty()) {
+    tag_grams.erase(entry.tag.lower(), id);
+    tag_ids.erase(entry.tag);
+    free_tag_ids.push_back(id);
+  }
+}
+
+auto ImageLibrary::indexTags(const std::vector<std::string>& tags,
+                             size_t position) -> std::vector<TagId> {
+  std::vector<TagId> ids;
+  ids.reserve(tags.size());
+  for (const auto& tag : tags) {
+    TagId id = internTag(tag);
+    addUse(id, &TagEntry::tagged, position);
+    ids.push_back(id);
+  }
+  return ids;
+}
+
+// Moves the tags of every image out of library and into the tag dictionary.
+void ImageLibrary::rebuildIndex() {
+  tag_entries.clear();
+  free_tag_ids.clear();
+  tag_ids.clear();
+  tag_grams.clear();
+  image_tags.clear();
+  image_tags.reserve(library.images_size());
+  for (int i = 0; i < library.images_size(); ++i) {
+    proto::ImageInfo* image = library.mutable_images(i);
+    TagId name = internTag(image->name());
+    addUse(name, &TagEntry::named, i);
+    std::vector<std::string> tags(image->tags().begin(), image->tags().end());
+    image_tags.push_back(ImageTags{.name = name, .tags = indexTags(tags, i)});
+    image->clear_tags();
+  }
+  rebuildPathIndex();
+}
+
+// Returns a copy of the image at position, with its tags filled back in.
+auto ImageLibrary::withTags(size_t position) const -> proto::ImageInfo {
+  proto::ImageInfo image = library.images(static_cast<int>(position));
+  for (TagId id : image_tags[position].tags) {
+    image.add_tags(tag_entries[id].tag.string());
+  }
+  return image;
+}
+
+// Returns a copy of the whole library, with every image's tags filled back in.
+auto ImageLibrary::exportLibrary() const -> proto::ImageLibrary {
+  proto::ImageLibrary exported = library;
+  for (int i = 0; i < exported.images_size(); ++i) {
+    for (TagId id : image_tags[i].tags) {
+      exported.mutable_images(i)->add_tags(tag_entries[id].tag.string());
+    }
+  }
+  return exported;
+}
+
+void ImageLibrary::indexPath(const std::string& path, size_t position) {
+  insertPosition(&path_index[pathKey(path)], position);
+}
+
+void ImageLibrary::rebuildPathIndex() {
+  path_index.clear();
+  path_index.reserve(library.images_size());
+  for (int i = 0; i < library.images_size(); ++i) {
+    indexPath(library.images(i).file_path(), i);
+  }
+}
+
+// Returns the position of the first image with the given path, if any.
+auto ImageLibrary::imagePosition(const FilesystemPath& file) const
+    -> std::optional<size_t> {
+  auto entry = path_index.find(pathKey(file.string()));
+  if (entry == path_index.end()) {
+    return std::nullopt;
+  }
+  return entry->second.front();
 }
 
 auto ImageLibrary::allFilenames() -> std::vector<FilesystemPath> {
@@ -80,77 +235,87 @@ auto ImageLibrary::allFilenames() -> std::vector<FilesystemPath> {
 auto ImageLibrary::allTags(bool include_name) const
     -> std::vector<CaseOptionalString> {
   std::vector<CaseOptionalString> tags;
-  for (const auto& image : library.images()) {
-    if (include_name) {
-      insertIntoSortedVector(&tags, image.name());
-    }
-    for (const auto& tag : image.tags()) {
-      insertIntoSortedVector(&tags, tag);
+  tags.reserve(tag_ids.size());
+  for (const auto& [tag, id] : tag_ids) {
+    const TagEntry& entry = tag_entries[id];
+    if (!entry.tagged.empty() || (include_name && !entry.named.empty())) {
+      tags.push_back(tag);
     }
   }
   return tags;
 }
 
 auto ImageLibrary::temporaryClone() -> std::unique_ptr<TemporaryImageLibrary> {
-  proto::ImageLibrary library_copy;
-  library_copy.CopyFrom(library);
-  return std::make_unique<TemporaryImageLibrary>(singleton, library_copy);
+  return std::make_unique<TemporaryImageLibrary>(singleton, exportLibrary());
 }
 
 void ImageLibrary::copyFrom(const TemporaryImageLibrary& other) {
   // Unlikely to ever change, but for completeness, re-assign the singleton
   // pointer.
   this->singleton = other.singleton;
-  // Copy the incoming library to this one.
+  // Copy the incoming library to this one, along with its tags and indexes.
   this->library.CopyFrom(other.library);
-}
-
-auto ImageLibrary::infoByFile(const FilesystemPath& filename)
-    -> proto::ImageInfo {
-  for (auto image : library.images()) {
-    if (image.file_path() == filename.string()) {
-      return image;
-    }
-  }
-  return {};
+  this->tag_entries = other.tag_entries;
+  this->free_tag_ids = other.free_tag_ids;
+  this->tag_ids = other.tag_ids;
+  this->tag_grams = other.tag_grams;
+  this->image_tags = other.image_tags;
+  this->path_index = other.path_index;
+  ++generation;
 }
 
 void ImageLibrary::setName(const FilesystemPath& filename,
                            const std::string& name) {
-  for (auto& image : *library.mutable_images()) {
-    if (image.file_path() == filename.string()) {
-      image.set_name(name);
-      return;
-    }
+  std::optional<size_t> position = imagePosition(filename);
+  if (!position.has_value()) {
+    LogDebug("Attempt to set name of unknown file: %s", filename.c_str());
+    return;
   }
-  LogDebug("Attempt to set name of unknown file: %s", filename.c_str());
+  ImageTags& indexed = image_tags[*position];
+  TagId previous_name = indexed.name;
+  indexed.name = internTag(name);
+  addUse(indexed.name, &TagEntry::named, *position);
+  removeUse(previous_name, &TagEntry::named, *position);
+  library.mutable_images(static_cast<int>(*position))->set_name(name);
+  ++generation;
 }
 
 void ImageLibrary::setTags(const FilesystemPath& filename,
                            const std::vector<std::string>& tags) {
-  for (auto& image : *library.mutable_images()) {
-    if (image.file_path() == filename.string()) {
-      image.clear_tags();
-      for (const auto& tag : tags) {
-        image.add_tags(tag);
-      }
-      return;
-    }
+  std::optional<size_t> position = imagePosition(filename);
+  if (!position.has_value()) {
+    LogDebug("Attempt to set tags of unknown file: %s", filename.c_str());
+    return;
   }
-  LogDebug("Attempt to set tags of unknown file: %s", filename.c_str());
+  ImageTags& indexed = image_tags[*position];
+  std::vector<TagId> previous_tags = std::move(indexed.tags);
+  indexed.tags = indexTags(tags, *position);
+  for (TagId id : previous_tags) {
+    removeUse(id, &TagEntry::tagged, *position);
+  }
+  ++generation;
 }
 
 auto ImageLibrary::name(const FilesystemPath& filename) -> std::string {
-  return infoByFile(filename).name();
+  std::optional<size_t> position = imagePosition(filename);
+  if (!position.has_value()) {
+    return "";
+  }
+  return library.images(static_cast<int>(*position)).name();
 }
 
 auto ImageLibrary::tags(const FilesystemPath& filename)
     -> std::vector<CaseOptionalString> {
-  proto::ImageInfo image = infoByFile(filename);
+  std::optional<size_t> position = imagePosition(filename);
   std::vector<CaseOptionalString> tags;
-  for (const auto& tag : image.tags()) {
-    insertIntoSortedVector(&tags, tag);
+  if (!position.has_value()) {
+    return tags;
+  }
+  for (TagId id : image_tags[*position].tags) {
+    tags.push_back(tag_entries[id].tag);
   }
+  std::sort(tags.begin(), tags.end());
+  tags.erase(std::unique(tags.begin(), tags.end()), tags.end());
   return tags;
 }
 
@@ -163,10 +328,14 @@ auto ImageLibrary::addImage(const FilesystemPath& file, const std::string& name,
   new_image->set_file_path(rel_path.string());
   new_image->set_is_relative(rel_path.is_relative());
   new_image->set_name(name);
-  for (const auto& tag : tags) {
-    new_image->add_tags(tag);
-  }
-  return *new_image;
+  auto position = static_cast<size_t>(library.images_size() - 1);
+  TagId name_id = internTag(name);
+  addUse(name_id, &TagEntry::named, position);
+  image_tags.push_back(
+      ImageTags{.name = name_id, .tags = indexTags(tags, position)});
+  indexPath(new_image->file_path(), position);
+  ++generation;
+  return withTags(position);
 }
 
 auto ImageLibrary::moveImage(const FilesystemPath& previous_path,
@@ -174,26 +343,90 @@ auto ImageLibrary::moveImage(const FilesystemPath& previous_path,
     -> proto::ImageInfo {
   FilesystemPath rel_path = FilesystemPath(FilesystemPath::mostRelativePath(
       libraryRoot().string(), new_path.string()));
-  auto* images = library.mutable_images();
   proto::ImageInfo last_changed;
-  for (auto& image : *images) {
-    if (FilesystemPath(image.file_path()) == previous_path) {
-      image.set_file_path(rel_path.string());
-      image.set_is_relative(rel_path.is_relative());
-      last_changed = image;
-    }
+  auto entry = path_index.find(pathKey(previous_path.string()));
+  if (entry == path_index.end()) {
+    return last_changed;
   }
+  std::vector<size_t> positions = std::move(entry->second);
+  path_index.erase(entry);
+  for (size_t position : positions) {
+    proto::ImageInfo* image =
+        library.mutable_images(static_cast<int>(position));
+    image->set_file_path(rel_path.string());
+    image->set_is_relative(rel_path.is_relative());
+    indexPath(image->file_path(), position);
+    last_changed = withTags(position);
+  }
+  ++generation;
   return last_changed;
 }
 
 void ImageLibrary::deleteImage(const FilesystemPath& file) {
+  deleteImages({file});
+}
+
+void ImageLibrary::deleteImages(const std::vector<FilesystemPath>& files) {
+  // Each file removes the first image with its path which hasn't already been
+  // removed, as if each were deleted in turn.
+  std::vector<bool> removed(library.images_size(), false);
+  std::unordered_map<std::string, size_t> removed_per_path;
+  bool any_removed = false;
+  for (const auto& file : files) {
+    auto entry = path_index.find(pathKey(file.string()));
+    if (entry == path_index.end()) {
+      continue;
+    }
+    size_t& count = removed_per_path[entry->first];
+    if (count < entry->second.size()) {
+      removed[entry->second[count++]] = true;
+      any_removed = true;
+    }
+  }
+  if (!any_removed) {
+    return;
+  }
+
+  // Close up the gaps left by the removed images, noting where each remaining
+  // image ends up.
   auto* images = library.mutable_images();
-  for (auto itr = images->begin(); itr < images->end(); itr++) {
-    if (FilesystemPath(itr->file_path()) == file) {
-      images->erase(itr);
-      return;
+  std::vector<std::optional<size_t>> moved(removed.size());
+  size_t kept = 0;
+  for (size_t i = 0; i < removed.size(); ++i) {
+    if (removed[i]) {
+      continue;
+    }
+    if (kept != i) {
+      images->SwapElements(static_cast<int>(kept), static_cast<int>(i));
+      image_tags[kept] = std::move(image_tags[i]);
+    }
+    moved[i] = kept++;
+  }
+  images->DeleteSubrange(static_cast<int>(kept),
+                         static_cast<int>(removed.size() - kept));
+  image_tags.resize(kept);
+
+  // Then update every use of every name, tag and path in a single pass,
+  // however many images were removed.
+  for (size_t id = 0; id < tag_entries.size(); ++id) {
+    TagEntry& entry = tag_entries[id];
+    if (entry.named.empty() && entry.tagged.empty()) {
+      // Already free.
+      continue;
+    }
+    remapPositions(&entry.named, moved);
+    remapPositions(&entry.tagged, moved);
+    if (entry.named.empty() && entry.tagged.empty()) {
+      tag_grams.erase(entry.tag.lower(), static_cast<TagId>(id));
+      tag_ids.erase(entry.tag);
+      free_tag_ids.push_back(static_cast<TagId>(id));
     }
   }
+  for (auto entry = path_index.begin(); entry != path_index.end();) {
+    remapPositions(&entry->second, moved);
+    entry = entry->second.empty() ? path_index.erase(entry) : std::next(entry);
+  }
+  ++generation;
 }
 
 auto ImageLibrary::libraryRoot() -> FilesystemPath {
@@ -207,10 +440,14 @@ void ImageLibrary::removeLibraryRoot() {
                                                      image.file_path()));
   }
   library.clear_library_root();
+  rebuildPathIndex();
+  ++generation;
 }
 
 void ImageLibrary::moveLibraryRoot(const FilesystemPath& root) {
   library.set_library_root(root.string());
+  // Search results hold absolute paths, which depend on the root.
+  ++generation;
 }
 
 void ImageLibrary::setLibraryRoot(const FilesystemPath& root) {
@@ -224,6 +461,7 @@ void ImageLibrary::setLibraryRoot(const FilesystemPath& root) {
     image.set_is_relative(FilesystemPath(rel_path).is_relative());
   }
   moveLibraryRoot(root);
+  rebuildPathIndex();
 }
 
 void ImageLibrary::smartUpdateLibraryRoot(const FilesystemPath& root) {
@@ -264,7 +502,8 @@ auto ImageLibrary::detectLibraryChanges(bool delete_missing)
       FilesystemPath(library.library_root())
           .findFilesOfType(extensions, MAXIMUM_DIRECTORY_CRAWL_DEPTH);
   // Map out which images in the library are present on disk and which aren't.
-  for (const auto& image : library.images()) {
+  for (int i = 0; i < library.images_size(); ++i) {
+    const proto::ImageInfo& image = library.images(i);
     if (FilesystemPath(image.file_path())
             .existsWithRoot(library.library_root())) {
       std::string abs_path = FilesystemPath::absolutePath(
@@ -272,10 +511,10 @@ auto ImageLibrary::detectLibraryChanges(bool delete_missing)
       if (files_on_disk.find(abs_path) != files_on_disk.end()) {
         files_on_disk.erase(abs_path);
       } else {
-        external_to_library.emplace_back(image);
+        external_to_library.emplace_back(withTags(i));
       }
     } else {
-      missing_images.emplace_back(image);
+      missing_images.emplace_back(withTags(i));
     }
   }
 
@@ -316,32 +555,57 @@ auto ImageLibrary::detectLibraryChanges(bool delete_missing)
   std::vector<ImageChange> deletes;
   // Remove missing images, if applicable.
   if (delete_missing) {
+    std::vector<FilesystemPath> missing_files;
+    missing_files.reserve(missing_images.size());
     for (const auto& missing : missing_images) {
-      deleteImage(FilesystemPath(FilesystemPath::mostRelativePath(
-          library.library_root(), missing.file_path())));
+      missing_files.emplace_back(FilesystemPath::mostRelativePath(
+          library.library_root(), missing.file_path()));
       deletes.emplace_back(proto::ImageInfo(), missing);
     }
+    deleteImages(missing_files);
   }
 
   return {adds, moves, deletes};
 }
 
-void ImageLibrary::clearLibrary() { library.Clear(); }
+void ImageLibrary::clearLibrary() {
+  library.Clear();
+  tag_entries.clear();
+  free_tag_ids.clear();
+  tag_ids.clear();
+  tag_grams.clear();
+  image_tags.clear();
+  path_index.clear();
+  ++generation;
+}
 
 void ImageLibrary::saveLibrary() {
   if (enable_persistence) {
-    singleton->persistence()->saveImageLibrary(library);
+    singleton->persistence()->saveImageLibrary(exportLibrary());
   }
 }
 
 auto ImageLibrary::search(const std::string& query) -> ImageSearchResults {
+  // Paging through results repeats the same search, so recent results are
+  // kept until the library next changes.
+  CachedSearch* cached = search_cache.find(query);
+  if (cached != nullptr && cached->generation == generation) {
+    return cached->results;
+  }
+  ImageSearchResults results = uncachedSearch(query);
+  search_cache.insert(
+      query, CachedSearch{.generation = generation, .results = results});
+  return results;
+}
+
+auto ImageLibrary::uncachedSearch(const std::string& query)
+    -> ImageSearchResults {
   if (query.empty()) {
     // Empty search is a special case where we just return all
     return emptySearch();
   }
 
-  auto tags = allTags(/*include_name=*/true);
-  if (binary_search(tags.begin(), tags.end(), CaseOptionalString(query))) {
+  if (tag_ids.contains(CaseOptionalString(query))) {
     return exactMatchSearch(query);
   }
   return partialMatchSearch(query);
@@ -355,6 +619,17 @@ void ImageLibrary::addMatch(std::vector<proto::ImageInfo>* matched_images,
   matched_images->emplace_back(image_copy);
 }
 
+// Returns the images at the given positions, in the order given.
+auto ImageLibrary::imagesAt(const std::vector<size_t>& positions)
+    -> std::vector<proto::ImageInfo> {
+  std::vector<proto::ImageInfo> matched_images;
+  matched_images.reserve(positions.size());
+  for (size_t position : positions) {
+    addMatch(&matched_images, library.images(static_cast<int>(position)));
+  }
+  return matched_images;
+}
+
 auto ImageLibrary::emptySearch() -> ImageSearchResults {
   std::vector<proto::ImageInfo> matched_images;
   for (const auto& image : library.images()) {
@@ -365,45 +640,47 @@ auto ImageLibrary::emptySearch() -> ImageSearchResults {
 
 auto ImageLibrary::exactMatchSearch(const std::string& query)
     -> ImageSearchResults {
-  std::vector<proto::ImageInfo> matched_images;
-  for (const auto& image : library.images()) {
-    if ((image.name() == query) ||
-        (std::find(image.tags().begin(), image.tags().end(), query) !=
-         image.tags().end())) {
-      addMatch(&matched_images, image);
-    }
+  auto id = tag_ids.find(CaseOptionalString(query));
+  if (id == tag_ids.end()) {
+    return {{}, query, std::vector<CaseOptionalString>()};
   }
-  if (matched_images.empty()) {
-    return {matched_images, query, std::vector<CaseOptionalString>()};
-  }
-  return {matched_images, query,
+  const TagEntry& entry = tag_entries[id->second];
+  std::vector<size_t> positions = entry.named;
+  positions.insert(positions.end(), entry.tagged.begin(), entry.tagged.end());
+  sortUnique(&positions);
+  return {imagesAt(positions), query,
           std::vector<CaseOptionalString>({CaseOptionalString(query)})};
 }
 
 auto ImageLibrary::partialMatchSearch(const std::string& query)
     -> ImageSearchResults {
   CaseOptionalString lower_query(query);
-  std::vector<proto::ImageInfo> matched_images;
+  // Images with a name or tag starting with the query are listed before those
+  // which only contain it somewhere else.
+  std::vector<size_t> prefix_matches;
+  std::vector<size_t> other_matches;
   std::vector<CaseOptionalString> matched_tags;
-  for (const auto& image : library.images()) {
-    bool image_matched = false;
-    if (CaseOptionalString(image.name()).find(lower_query) !=
-        std::string::npos) {
-      addMatch(&matched_images, image);
-      insertIntoSortedVector(&matched_tags, image.name());
-      image_matched = true;
-    }
-    for (const auto& tag : image.tags()) {
-      if (CaseOptionalString(tag).substring(lower_query)) {
-        if (!image_matched) {
-          addMatch(&matched_images, image);
-        }
-        image_matched = true;
-        insertIntoSortedVector(&matched_tags, tag);
-      }
+  for (TagId id : tag_grams.candidates(lower_query.lower())) {
+    const TagEntry& entry = tag_entries[id];
+    size_t found = entry.tag.find(lower_query);
+    if (found == std::string::npos) {
+      continue;
     }
+    matched_tags.push_back(entry.tag);
+    std::vector<size_t>* matches =
+        found == 0 ? &prefix_matches : &other_matches;
+    matches->insert(matches->end(), entry.named.begin(), entry.named.end());
+    matches->insert(matches->end(), entry.tagged.begin(), entry.tagged.end());
   }
-  return {matched_images, query, matched_tags};
+  std::sort(matched_tags.begin(), matched_tags.end());
+
+  sortUnique(&prefix_matches);
+  sortUnique(&other_matches);
+  std::vector<size_t> positions = prefix_matches;
+  std::set_difference(other_matches.begin(), other_matches.end(),
+                      prefix_matches.begin(), prefix_matches.end(),
+                      std::back_inserter(positions));
+  return {imagesAt(positions), query, matched_tags};
 }
 
 TemporaryImageLibrary::TemporaryImageLibrary(Singleton* singleton,
@@ -413,18 +690,18 @@ TemporaryImageLibrary::TemporaryImageLibrary(Singleton* singleton,
 }
 
 ImageSearchResults::ImageSearchResults(
-    const std::vector<proto::ImageInfo>& matched_images,
-    const std::string& search_string,
-    const std::vector<CaseOptionalString>& matched_tag_list) {
-  this->matched_images = matched_images;
-  this->search_string = search_string;
-  this->matched_tag_list = matched_tag_list;
-}
+    std::vector<proto::ImageInfo> matched_images, std::string search_string,
+    std::vector<CaseOptionalString> matched_tag_list)
+    : matched_images(std::make_shared<const std::vector<proto::ImageInfo>>(
+          std::move(matched_images))),
+      search_string(std::move(search_string)),
+      matched_tag_list(std::make_shared<const std::vector<CaseOptionalString>>(
+          std::move(matched_tag_list))) {}
 
 auto ImageSearchResults::filenames() -> std::vector<FilesystemPath> {
   std::vector<FilesystemPath> files;
-  files.reserve(matched_images.size());
-  for (const auto& image : matched_images) {
+  files.reserve(matched_images->size());
+  for (const auto& image : *matched_images) {
     files.emplace_back(image.file_path());
   }
   return files;
@@ -432,8 +709,8 @@ auto ImageSearchResults::filenames() -> std::vector<FilesystemPath> {
 
 auto ImageSearchResults::matchedTags() -> std::vector<std::string> {
   std::vector<std::string> tags;
-  tags.reserve(matched_tag_list.size());
-  for (const auto& tag : matched_tag_list) {
+  tags.reserve(matched_tag_list->size());
+  for (const auto& tag : *matched_tag_list) {
     tags.push_back(tag.string());
   }
   return tags;
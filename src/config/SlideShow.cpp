@@ -19,17 +19,24 @@ limitations under the License.
 
 #include "config/SlideShow.h"
 
-#include <utility>  // for move
+#include <algorithm>  // for find_if, max
+#include <cmath>      // for llround
+#include <utility>    // for move
+#include <vector>     // for erase_if
 
-#include "config/Persistence.h"   // for Persistence
-#include "util/FilesystemPath.h"  // for FilesystemPath
-#include "util/Singleton.h"       // for Singleton, SingletonClass
-// IWYU pragma: no_include <algorithm> -- it's nondeterministically included
+#include "config/Persistence.h"         // for Persistence
+#include "ui/event/AutoRefreshTimer.h"  // for AutoRefreshTimer
+#include "util/AnimationClock.h"        // for AnimationClock
+#include "util/FilesystemPath.h"        // for FilesystemPath
+#include "util/Singleton.h"             // for Singleton, SingletonClass
 // IWYU pragma: no_include <google/protobuf/repeated_ptr_field.h>
 // IWYU pragma: no_include "net/proto2/public/repeated_field.h"
 
 namespace cszb_scoreboard {
 
+// How many slides after the current one are loaded ahead of time.
+constexpr int32_t SLIDE_PREFETCH_COUNT = 2;
+
 SlideShow::SlideShow(SingletonClass c, Singleton* singleton) {
   this->singleton = singleton;
   this->slide_show =
@@ -44,7 +51,7 @@ void SlideShow::swapSlides(int32_t a, int32_t b) {
     return;
   }
   slide_show.mutable_slides()->SwapElements(a, b);
-  last_returned_slide_number = -1;
+  prefetch();
 }
 
 void SlideShow::removeSlide(int32_t index) {
@@ -52,7 +59,10 @@ void SlideShow::removeSlide(int32_t index) {
     slide_show.mutable_slides()->SwapElements(i, i + 1);
   }
   slide_show.mutable_slides()->RemoveLast();
-  last_returned_slide_number = -1;
+  if (slide_number >= slide_show.slides_size()) {
+    slide_number = 0;
+  }
+  prefetch();
 }
 
 // -1 index is the default and means to add the slide to the end of the list.
@@ -61,15 +71,14 @@ void SlideShow::addSlide(const std::string& name, const FilesystemPath& file,
   proto::SlideInfo* slide = slide_show.add_slides();
   slide->set_name(name);
   slide->set_file_path(file.string());
-  if (index == -1) {
-    return;
-  }
-  int i = slide_show.mutable_slides()->size() - 1;
-  while (i > index) {
-    swapSlides(i, i - 1);
-    --i;
+  if (index != -1) {
+    int i = slide_show.mutable_slides()->size() - 1;
+    while (i > index) {
+      slide_show.mutable_slides()->SwapElements(i, i - 1);
+      --i;
+    }
   }
-  last_returned_slide_number = -1;
+  prefetch();
 }
 
 void SlideShow::saveShow() {
@@ -88,47 +97,180 @@ auto SlideShow::slides(int32_t start, int32_t end)
 
 void SlideShow::start() {
   is_running = true;
-  last_transition = std::chrono::duration_cast<std::chrono::seconds>(
-      std::chrono::system_clock::now().time_since_epoch());
-  last_returned_slide_number = -1;
+  last_transition = AnimationClock::now();
+  next_transition = last_transition + delayMillis();
+  prefetch();
+}
+
+void SlideShow::stop() {
+  is_running = false;
+  // Release the prepared slides, but remember the sizes they were prepared
+  // for, so the next show can start loading as soon as it starts.
+  for (auto& queue : prefetch_queues) {
+    queue.slides.clear();
+    queue.shown = Image();
+  }
+  // Nothing moves on once the show stops, so repaint now to take it down.
+  requestRefresh();
+}
+
+void SlideShow::setDelay(double delay) {
+  slide_show.set_delay(delay);
+  if (is_running) {
+    next_transition = last_transition + delayMillis();
+    // The new transition may be due sooner than the one we're waiting on.
+    wakeRefreshTimer();
+  }
 }
-void SlideShow::stop() { is_running = false; }
 
-auto SlideShow::nextSlide() -> Image {
+auto SlideShow::delayMillis() -> int64_t {
+  // NOLINTNEXTLINE(readability-magic-numbers)
+  return std::max<int64_t>(std::llround(delay() * 1000.0), 1);
+}
+
+void SlideShow::advance(int64_t now) {
+  if (!is_running || now < next_transition) {
+    return;
+  }
+  // We're normally woken right at the deadline, but if we've fallen behind
+  // by more than a slide (e.g. the machine was asleep), catch up to the slide
+  // which should be showing now.
+  int64_t delay_millis = delayMillis();
+  int64_t transitions = (now - next_transition) / delay_millis + 1;
+  last_transition = next_transition + (transitions - 1) * delay_millis;
+  next_transition = last_transition + delay_millis;
+  dropUnrequestedQueues();
+
+  int32_t count = slide_show.slides_size();
+  if (count == 0) {
+    return;
+  }
+  slide_number = static_cast<int32_t>((slide_number + transitions) % count);
+  prefetch();
+}
+
+auto SlideShow::currentSlide(const Size& fit_size) -> Image {
   // We can't expect to run an empty slide show.
   if (slide_show.slides_size() == 0) {
     is_running = false;
     return {};
   }
 
-  // Check for end of show and loop.
-  if (slide_number >= slide_show.slides_size()) {
-    slide_number = 0;
+  PrefetchQueue* queue = prefetchQueue(fit_size);
+  // Until the current slide is ready, keep showing whatever was shown last.
+  if (!queue->slides.empty() && queue->slides.front().request.isReady()) {
+    queue->shown = *queue->slides.front().request.image();
+  }
+  return queue->shown;
+}
+
+auto SlideShow::prefetchQueue(const Size& fit_size) -> PrefetchQueue* {
+  for (auto& queue : prefetch_queues) {
+    if (queue.fit_size == fit_size) {
+      queue.requested = true;
+      return &queue;
+    }
   }
+  // The first time a screen of this size asks for a slide, start preparing
+  // slides for it from here on.
+  prefetch_queues.push_back(PrefetchQueue{.fit_size = fit_size});
+  prefetch(&prefetch_queues.back());
+  return &prefetch_queues.back();
+}
 
-  auto slide = slide_show.slides(slide_number);
-  auto left_millis = std::chrono::duration_cast<std::chrono::milliseconds>(
-                         std::chrono::system_clock::now().time_since_epoch()) -
-                     last_transition;
-  // NOLINTNEXTLINE(readability-magic-numbers)
-  double time_left = left_millis.count() / 1000.0;
-  if (time_left > slide_show.delay()) {
-    last_transition = std::chrono::duration_cast<std::chrono::seconds>(
-        std::chrono::system_clock::now().time_since_epoch());
-    ++slide_number;
-    if (slide_number >= slide_show.slides_size()) {
-      slide_number = 0;
+/* Screens ask for the current slide every time they paint, which they do at
+ * least once per transition, so a size nobody has asked for since the last one
+ * belongs to a screen which has since been resized or hidden.  Dropping those
+ * keeps us from loading slides at every size a screen has ever been. */
+void SlideShow::dropUnrequestedQueues() {
+  std::erase_if(prefetch_queues, [](const PrefetchQueue& queue) -> bool {
+    return !queue.requested;
+  });
+  for (auto& queue : prefetch_queues) {
+    queue.requested = false;
+  }
+}
+
+void SlideShow::prefetch() {
+  if (!is_running) {
+    return;
+  }
+  for (auto& queue : prefetch_queues) {
+    prefetch(&queue);
+  }
+}
+
+/* Makes sure the current slide and the few after it are loaded (or loading)
+ * for the given queue's size.  Slides which are already in the queue are kept,
+ * matched by file, so slides being added, removed or reordered in the middle of
+ * a show only load what's actually new. */
+void SlideShow::prefetch(PrefetchQueue* queue) {
+  int32_t count = slide_show.slides_size();
+  if (count == 0) {
+    queue->slides.clear();
+    return;
+  }
+  std::vector<PrefetchedSlide> slides;
+  for (int32_t i = 0; i <= SLIDE_PREFETCH_COUNT && i < count; ++i) {
+    const std::string& file_path =
+        slide_show.slides((slide_number + i) % count).file_path();
+    auto existing = std::find_if(
+        queue->slides.begin(), queue->slides.end(),
+        [&file_path](const PrefetchedSlide& slide) -> bool {
+          return slide.file_path == file_path;
+        });
+    if (existing != queue->slides.end()) {
+      slides.push_back(std::move(*existing));
+      queue->slides.erase(existing);
+      continue;
     }
-    slide = slide_show.slides(slide_number);
+    slides.push_back(PrefetchedSlide{
+        .file_path = file_path,
+        .request = singleton->imageLoader()->load(
+            FilesystemPath(file_path), queue->fit_size,
+            [this, file_path](const Image& image) -> void {
+              slideLoaded(file_path);
+            })});
   }
+  // Anything left over is no longer coming up, so its load is canceled.
+  queue->slides = std::move(slides);
+}
 
-  if (slide_number == last_returned_slide_number) {
-    return cached_image;
+void SlideShow::slideLoaded(const std::string& file_path) {
+  if (slide_number >= slide_show.slides_size() ||
+      slide_show.slides(slide_number).file_path() != file_path) {
+    return;
   }
+  // Slides are only fetched while painting, so ask for a paint to pick this one
+  // up.
+  requestRefresh();
+}
 
-  last_returned_slide_number = slide_number;
-  cached_image = Image(FilesystemPath(slide.file_path()));
-  return cached_image;
+void SlideShow::requestRefresh() {
+  AutoRefreshTimer* refresh_timer = singleton->autoRefreshTimer();
+  // May be null when the singleton is mocked.
+  if (refresh_timer != nullptr) {
+    refresh_timer->requestRefresh();
+  }
+}
+
+void SlideShow::wakeRefreshTimer() {
+  AutoRefreshTimer* refresh_timer = singleton->autoRefreshTimer();
+  // May be null when the singleton is mocked.
+  if (refresh_timer != nullptr) {
+    refresh_timer->wake();
+  }
+}
+
+auto SlideShow::nextTransition(int64_t after_ms) const
+    -> std::optional<int64_t> {
+  if (!is_running || slide_show.slides_size() == 0) {
+    return std::nullopt;
+  }
+  if (last_transition > after_ms) {
+    return last_transition;
+  }
+  return next_transition;
 }
 
 }  // namespace cszb_scoreboard
@@ -21,7 +21,10 @@ limitations under the License.
 
 #include <wx/aui/auibook.h>  // for wxAuiNotebookEvent
 
-#include <utility>  // for move
+#include <algorithm>  // for any_of
+#include <cstdint>    // for int64_t
+#include <optional>   // for optional, nullopt
+#include <utility>    // for move
 
 #include "ui/component/control/ImageFromLibrary.h"  // for ImageFromLibrary
 #include "ui/component/control/ImageSearch.h"  // IWYU pragma: keep for ImageSearch
@@ -39,6 +42,8 @@ namespace swx {
 class Notebook;
 }  // namespace swx
 
+constexpr int64_t CONTROL_ANIMATION_MILLIS = 50;  // 20 hz animation frequency
+
 ControlPanel::ControlPanel(swx::Notebook* wx, Singleton* singleton)
     : Notebook(wx) {
   addController(std::move(ScoreControl::Create(childPanel())), "Score");
@@ -80,6 +85,22 @@ auto ControlPanel::isSelected(ScreenTextController* controller) const -> bool {
   return controllers[selection()].get() == controller;
 }
 
+auto ControlPanel::refreshAnimations(int64_t now) const
+    -> std::optional<int64_t> {
+  bool animated = std::any_of(controllers.begin(), controllers.end(),
+                              [this](const auto& controller) {
+                                return isSelected(controller.get()) &&
+                                       controller->hasAnimation();
+                              });
+  if (!animated) {
+    return std::nullopt;
+  }
+  // Controllers don't track when their previews change, so just redraw them at
+  // a steady rate while any are animated.
+  refresh();
+  return now + CONTROL_ANIMATION_MILLIS;
+}
+
 void ControlPanel::refresh() const {
   for (const auto& controller : controllers) {
     if (isSelected(controller.get())) {
@@ -25,6 +25,7 @@ limitations under the License.
 #include "config.pb.h"                   // for ScreenSide, DisplayInfo
 #include "config/DisplayConfig.h"        // for DisplayConfig
 #include "ui/component/ScreenPreview.h"  // for ScreenPreview
+#include "util/AnimationClock.h"         // for AnimationClock
 
 namespace cszb_scoreboard {
 
@@ -116,4 +117,13 @@ void PreviewPanel::refresh() const {
   }
 }
 
+auto PreviewPanel::refreshAnimations(int64_t now) const
+    -> std::optional<int64_t> {
+  std::optional<int64_t> next;
+  for (const auto& screen : screens) {
+    next = AnimationClock::earliest(next, screen->refreshAnimations(now));
+  }
+  return next;
+}
+
 }  // namespace cszb_scoreboard
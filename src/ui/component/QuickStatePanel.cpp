@@ -34,6 +34,7 @@ limitations under the License.
 #include "ui/frame/HotkeyTable.h"         // for HotkeyTable
 #include "ui/frame/MainView.h"            // for MainView
 #include "ui/graphics/Color.h"            // for Color
+#include "util/AnimationClock.h"          // for AnimationClock
 #include "util/ProtoUtil.h"               // for ProtoUtil
 #include "wx/accel.h"                     // for wxAcceleratorEntryFlags
 
@@ -183,6 +184,20 @@ void QuickStatePanel::setShortcut(QuickStateEntry* entry,
       ->updateScreenTextFromSelected(entry);
 }
 
+auto QuickStatePanel::refreshAnimations(int64_t now) const
+    -> std::optional<int64_t> {
+  std::optional<int64_t> next;
+  if (score_entry != nullptr) {
+    next = score_entry->refreshAnimations(now);
+  }
+  for (const auto& entry : entries) {
+    if (entry != nullptr) {
+      next = AnimationClock::earliest(next, entry->refreshAnimations(now));
+    }
+  }
+  return next;
+}
+
 void QuickStatePanel::refresh() const {
   if (score_entry != nullptr && score_entry->hasAnimation()) {
     score_entry->refresh();
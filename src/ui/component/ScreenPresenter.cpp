@@ -72,4 +72,12 @@ void ScreenPresenter::refreshWindow() {
   }
 }
 
+auto ScreenPresenter::refreshAnimations(int64_t now)
+    -> std::optional<int64_t> {
+  if (!screen_text) {
+    return std::nullopt;
+  }
+  return screen_text->refreshAnimations(now);
+}
+
 }  // namespace cszb_scoreboard
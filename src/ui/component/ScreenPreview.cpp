@@ -28,6 +28,7 @@ limitations under the License.
 #include "ui/component/ScreenText.h"       // for ScreenText
 #include "ui/frame/FrameManager.h"         // for FrameManager
 #include "ui/graphics/Color.h"             // for Color
+#include "util/AnimationClock.h"           // for AnimationClock
 #include "util/ProtoUtil.h"                // for ProtoUtil
 
 namespace cszb_scoreboard {
@@ -117,4 +118,10 @@ void ScreenPreview::refresh() {
   thumbnail->refresh();
 }
 
+auto ScreenPreview::refreshAnimations(int64_t now) const
+    -> std::optional<int64_t> {
+  return AnimationClock::earliest(screen_text->refreshAnimations(now),
+                                  thumbnail->refreshAnimations(now));
+}
+
 }  // namespace cszb_scoreboard
@@ -27,6 +27,7 @@ limitations under the License.
 #include "config/SlideShow.h"             // for SlideShow
 #include "config/TeamConfig.h"            // for TeamConfig
 #include "ui/component/ScreenTextSide.h"  // for ScreenTextSide, ScreenTextC...
+#include "util/AnimationClock.h"          // for AnimationClock
 #include "util/ProtoUtil.h"               // for ProtoUtil
 
 namespace cszb_scoreboard {
@@ -322,6 +323,15 @@ void ScreenText::refresh() const {
   }
 }
 
+auto ScreenText::refreshAnimations(int64_t now) const
+    -> std::optional<int64_t> {
+  std::optional<int64_t> next;
+  for (auto* text_side : text_sides) {
+    next = AnimationClock::earliest(next, text_side->refreshAnimation(now));
+  }
+  return next;
+}
+
 auto ScreenText::hasAnimation() const -> bool {
   return std::any_of(text_sides.begin(), text_sides.end(),
                      [](auto* text_side) { return text_side->hasAnimation(); });
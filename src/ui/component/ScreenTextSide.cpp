@@ -20,21 +20,29 @@ limitations under the License.
 
 #include "ui/component/ScreenTextSide.h"
 
-#include <algorithm>  // for max
-#include <cstdint>    // for int64_t, int32_t
-
-#include "config/GeneralConfig.h"         // for GeneralConfig
-#include "config/Position.h"              // for Size, Position
-#include "config/SlideShow.h"             // for SlideShow
-#include "config/TeamConfig.h"            // for TeamConfig
-#include "config/swx/event.h"             // for wxEVT_PAINT
-#include "ui/graphics/BackgroundImage.h"  // for BackgroundImage
-#include "ui/widget/Panel.h"              // for Panel
-#include "ui/widget/RenderContext.h"      // for RenderContext
-#include "util/FontUtil.h"                // for FontUtil
-#include "util/ProtoUtil.h"               // for ProtoUtil
-#include "util/TimerManager.h"            // for TimerManager
-#include "wx/image.h"                     // for wxImage
+#include <algorithm>  // for max, min
+#include <cmath>      // for ceil
+#include <cstdint>    // for int64_t, int32_t, uint64_t
+#include <optional>   // for optional
+#include <string>     // for string, to_string
+
+#include "config/GeneralConfig.h"          // for GeneralConfig
+#include "config/Position.h"               // for Size, Position
+#include "config/SlideShow.h"              // for SlideShow
+#include "config/TeamConfig.h"             // for TeamConfig
+#include "config/swx/event.h"              // for wxEVT_PAINT
+#include "ui/event/AutoRefreshTimer.h"     // for AutoRefreshTimer
+#include "ui/graphics/BackgroundImage.h"   // for BackgroundImage
+#include "ui/graphics/PixelKernels.h"      // for PixelKernels
+#include "ui/graphics/ScaledImageCache.h"  // for ScaledImageCache
+#include "ui/widget/Panel.h"               // for Panel
+#include "ui/widget/RenderContext.h"       // for RenderContext
+#include "util/AnimationClock.h"           // for AnimationClock
+#include "util/FontUtil.h"                 // for FontUtil
+#include "util/LruCache.h"                 // for LruCache
+#include "util/ProtoUtil.h"                // for ProtoUtil
+#include "util/TimerManager.h"             // for TimerManager
+#include "wx/image.h"                      // for wxImage
 
 // IWYU pragma: no_include "wx/gtk/colour.h"
 
@@ -45,10 +53,24 @@ constexpr float TOP_OR_BOTTOM_MARGIN = 2.0F;
 constexpr float TOP_OR_BOTTOM_RATIO = TOP_OR_BOTTOM_MARGIN / 100;
 constexpr float BOTTOM_CORNER_OVERLAY_SCALE = 0.30F;
 constexpr float AUTOFIT_FONT_ADJUSTMENT = 0.5F;
+constexpr size_t AUTOFIT_CACHE_SIZE = 256;
 constexpr float TIMER_BACKGROUND_PCT = .25;
 constexpr float TIMER_FONT_SIZE = 10;
 constexpr int TIMER_ALPHA = 128;
 
+// Describes the visible state of an image for layer stamping, so that a new
+// image or a new animation frame causes its layer to be re-rendered.
+static auto imageStamp(const Image& image, int64_t now_ms) -> std::string {
+  if (!image.isOk()) {
+    return "";
+  }
+  std::string stamp = std::to_string(image.contentId());
+  if (image.isAnimated()) {
+    stamp += ":" + std::to_string(image.frameIndex(now_ms));
+  }
+  return stamp;
+}
+
 ScreenTextSide::ScreenTextSide(swx::Panel* wx, ScreenTextSide* source_side,
                                Size size, ScreenTextCategory category,
                                Singleton* singleton)
@@ -92,6 +114,11 @@ ScreenTextSide::ScreenTextSide(Singleton* singleton, swx::Panel* wx,
   this->image_is_scaled = false;
   this->screen_side = side;
   this->singleton = singleton;
+  layer_renderers = {
+      [this](RenderContext* renderer) -> void { renderBackground(renderer); },
+      [this](RenderContext* renderer) -> void { renderOverlay(renderer); },
+      [this](RenderContext* renderer) -> void { renderAllText(renderer); },
+      [this](RenderContext* renderer) -> void { renderTimer(renderer); }};
 }
 
 void ScreenTextSide::bindEvents() {
@@ -102,12 +129,14 @@ void ScreenTextSide::bindEvents() {
 void ScreenTextSide::resetAllText(const proto::ScreenSide& side) {
   if (isSide(side)) {
     texts.clear();
+    invalidateText();
   }
 }
 
 void ScreenTextSide::setAutoFit(bool auto_fit, const proto::ScreenSide& side) {
   if (isSide(side)) {
     auto_fit_text = auto_fit;
+    invalidateText();
   }
 }
 
@@ -118,6 +147,7 @@ void ScreenTextSide::addText(const proto::RenderableText& text,
     ProtoUtil::validateFont(mutable_text.mutable_font());
     setFontColor(mutable_text.mutable_font(), side);
     texts.push_back(mutable_text);
+    invalidateText();
   }
 }
 
@@ -146,6 +176,18 @@ void ScreenTextSide::initializeForColor(Size size, const Color& color) {
     ProtoUtil::setFontColor(text.mutable_font(), color.contrastColor());
   }
   createBlackout();
+  compositor.invalidateAll();
+}
+
+void ScreenTextSide::invalidateLayer(ScreenLayer layer) {
+  compositor.invalidate(static_cast<size_t>(layer));
+}
+
+void ScreenTextSide::invalidateText() {
+  // The overlay is tinted to match the first line of text, so it must be
+  // re-rendered along with the text whenever it is present.
+  invalidateLayer(background_overlay.has_value() ? ScreenLayer::Overlay
+                                                 : ScreenLayer::Text);
 }
 
 void ScreenTextSide::createBlackout() {
@@ -171,6 +213,7 @@ void ScreenTextSide::setSize(const Size& size) {
   Panel::setSize(size);
   if (screen_side.error()) {
     image = BackgroundImage::errorImage(this->size());
+    compositor.invalidateAll();
   } else if (background_color.has_value()) {
     initializeForColor(this->size(), *background_color);
   }
@@ -181,23 +224,14 @@ void ScreenTextSide::blackout() {
   background_color = Color("Black");
   image = blackout_image;
   resetAllText(screen_side);
+  compositor.invalidateAll();
   refresh();
 }
 
 void ScreenTextSide::renderScaledBackground(RenderContext* renderer,
                                             const Image& image) {
-  bool isSame = false;
-  if (!image.isOk() && !last_source_image.isOk()) {
-    isSame = true;
-  } else if (image.isOk() && last_source_image.isOk()) {
-    isSame = (image.wx().GetData() == last_source_image.wx().GetData());
-  }
-
-  if (!isSame || size() != last_target_size) {
-    scaled_image = scaleImage(image, size());
-    last_source_image = image;
-    last_target_size = size();
-  }
+  Image scaled_image =
+      singleton->scaledImageCache()->scaledToFit(image, size());
   int x = (size().width - scaled_image.size().width) / 2;
   int y = (size().height - scaled_image.size().height) / 2;
   renderer->drawImage(blackout_image, 0, 0);
@@ -205,7 +239,7 @@ void ScreenTextSide::renderScaledBackground(RenderContext* renderer,
 }
 
 void ScreenTextSide::renderOverlay(RenderContext* renderer) {
-  if (!background_overlay.has_value()) {
+  if (current_slide.has_value() || !background_overlay.has_value()) {
     return;
   }
 
@@ -217,102 +251,57 @@ void ScreenTextSide::renderOverlay(RenderContext* renderer) {
 }
 
 void ScreenTextSide::renderOverlayBottomCorner(RenderContext* renderer) {
-  Color font_color("White");
-  if (!texts.empty()) {
-    font_color = ProtoUtil::wxClr(texts[0].font().color());
-  }
-  Size target_size = size() * BOTTOM_CORNER_OVERLAY_SCALE;
-
-  bool isSame = false;
-  if (!background_overlay->isOk() && !last_overlay_source_image.isOk()) {
-    isSame = true;
-  } else if (background_overlay->isOk() && last_overlay_source_image.isOk()) {
-    isSame = (background_overlay->wx().GetData() ==
-              last_overlay_source_image.wx().GetData());
-  }
-
-  if (!isSame || target_size != last_overlay_target_size ||
-      font_color != last_overlay_font_color) {
-    scaled_overlay = scaleImage(*background_overlay, target_size);
-    adjustOverlayColorAndAlpha(&scaled_overlay, font_color);
-    last_overlay_source_image = *background_overlay;
-    last_overlay_target_size = target_size;
-    last_overlay_font_color = font_color;
-  }
+  updateScaledOverlay(size() * BOTTOM_CORNER_OVERLAY_SCALE);
 
   int x = TOP_OR_BOTTOM_MARGIN;
   int y = size().height - scaled_overlay.size().height - TOP_OR_BOTTOM_MARGIN;
   renderer->drawImage(scaled_overlay, x, y);
+  compositor.setBounds(static_cast<size_t>(ScreenLayer::Overlay),
+                       Position{.x = x, .y = y}, scaled_overlay.size());
 }
 
 void ScreenTextSide::renderOverlayCentered(RenderContext* renderer) {
-  Color font_color("White");
-  if (!texts.empty()) {
-    font_color = ProtoUtil::wxClr(texts[0].font().color());
-  }
-  Size target_size = size() * overlay_percentage;
-
-  bool isSame = false;
-  if (!background_overlay->isOk() && !last_overlay_source_image.isOk()) {
-    isSame = true;
-  } else if (background_overlay->isOk() && last_overlay_source_image.isOk()) {
-    isSame = (background_overlay->wx().GetData() ==
-              last_overlay_source_image.wx().GetData());
-  }
-
-  if (!isSame || target_size != last_overlay_target_size ||
-      font_color != last_overlay_font_color) {
-    scaled_overlay = scaleImage(*background_overlay, target_size);
-    adjustOverlayColorAndAlpha(&scaled_overlay, font_color);
-    last_overlay_source_image = *background_overlay;
-    last_overlay_target_size = target_size;
-    last_overlay_font_color = font_color;
-  }
+  updateScaledOverlay(size() * overlay_percentage);
 
   int x = (size().width - scaled_overlay.size().width) / 2;
   int y = (size().height - scaled_overlay.size().height) / 2;
   renderer->drawImage(scaled_overlay, x, y);
+  compositor.setBounds(static_cast<size_t>(ScreenLayer::Overlay),
+                       Position{.x = x, .y = y}, scaled_overlay.size());
 }
 
-auto ScreenTextSide::renderSlide(RenderContext* renderer) -> bool {
-  if (category == ScreenTextCategory::Presenter &&
-      singleton->slideShow()->isRunning()) {
-    renderScaledBackground(renderer, singleton->slideShow()->nextSlide());
-    return true;
+// The scaled overlay is also tinted for this side, so it can't come straight
+// from the shared cache each paint.  Instead, it's remade only when the
+// overlay, its size, or the tint has changed.
+void ScreenTextSide::updateScaledOverlay(const Size& target_size) {
+  Color font_color("White");
+  if (!texts.empty()) {
+    font_color = ProtoUtil::wxClr(texts[0].font().color());
   }
-  return false;
+
+  if (background_overlay->contentId() == last_overlay_source_id &&
+      target_size == last_overlay_target_size &&
+      font_color == last_overlay_font_color &&
+      overlay_alpha == last_overlay_alpha) {
+    return;
+  }
+  scaled_overlay = singleton->scaledImageCache()->scaledToFit(
+      *background_overlay, target_size);
+  adjustOverlayColorAndAlpha(&scaled_overlay, font_color);
+  last_overlay_source_id = background_overlay->contentId();
+  last_overlay_target_size = target_size;
+  last_overlay_font_color = font_color;
+  last_overlay_alpha = overlay_alpha;
 }
 
 void ScreenTextSide::renderBackground(RenderContext* renderer) {
-  if (image_is_scaled) {
+  if (current_slide.has_value()) {
+    renderScaledBackground(renderer, *current_slide);
+  } else if (image_is_scaled) {
     renderScaledBackground(renderer, image);
   } else {
     renderer->drawImage(image, 0, 0);
   }
-  renderOverlay(renderer);
-}
-
-auto ScreenTextSide::scaleImage(const Image& image, const Size& target_size)
-    -> Image {
-  Image scaled_image = image;
-  Size image_size = scaled_image.size();
-  float screen_ratio = ratio(target_size);
-  float image_ratio = ratio(image_size);
-  int image_height;
-  int image_width;
-  if (screen_ratio > image_ratio) {
-    // Screen is wider than image, so make the heights match
-    image_height = target_size.height;
-    image_width = target_size.height * image_ratio;
-  } else {
-    // Screen is either the same ratio or narrower than image, so make the
-    // widths match
-    image_width = target_size.width;
-    image_height = target_size.width / image_ratio;
-  }
-
-  scaled_image.rescale(image_width, image_height);
-  return scaled_image;
 }
 
 void ScreenTextSide::adjustOverlayColorAndAlpha(Image* image,
@@ -320,54 +309,100 @@ void ScreenTextSide::adjustOverlayColorAndAlpha(Image* image,
   // We presume that the overlay is predominantly black, so subtracting it from
   // the font color should give us that color most of the time.
   image->color(color);
-  unsigned char* alpha = image->alpha();
-  for (int i = 0; i < image->size().width * image->size().height; i++) {
-    if (alpha[i] > overlay_alpha) {
-      alpha[i] = overlay_alpha;
-    }
-  }
+  PixelKernels::clampAlpha(
+      image->alpha(),
+      static_cast<size_t>(image->size().width) * image->size().height,
+      overlay_alpha);
+}
+
+static auto autoFitKey(const proto::RenderableText& text, const Size& size)
+    -> std::string {
+  return text.text() + '\0' + std::to_string(text.font().style()) + ':' +
+         std::to_string(text.font().size()) + ':' + std::to_string(size.width) +
+         'x' + std::to_string(size.height);
 }
 
 void ScreenTextSide::autoFitText(RenderContext* renderer,
                                  proto::RenderableText* text) {
-  proto::Font* font = text->mutable_font();
-
-  renderer->setFont(*font, size());
-  Size text_extent = getTextExtent(renderer, text->text());
-
-  while (text_extent.width > size().width && font->size() > 0) {
-    font->set_size(font->size() - AUTOFIT_FONT_ADJUSTMENT);
-    renderer->setFont(*font, size());
-    text_extent = getTextExtent(renderer, text->text());
+  // Every preview, thumbnail and presenter fits the same text, so the results
+  // are shared between all sides.
+  static auto* fitted_sizes =
+      new LruCache<std::string, float>(AUTOFIT_CACHE_SIZE);
+
+  std::string key = autoFitKey(*text, size());
+  float* fitted = fitted_sizes->find(key);
+  if (fitted != nullptr) {
+    text->mutable_font()->set_size(*fitted);
+    return;
   }
 
-  while (text_extent.height > size().height && font->size() > 0) {
-    font->set_size(font->size() - AUTOFIT_FONT_ADJUSTMENT);
-    renderer->setFont(*font, size());
-    text_extent = getTextExtent(renderer, text->text());
+  float fitted_size = fittedFontSize(renderer, *text);
+  fitted_sizes->insert(key, fitted_size);
+  text->mutable_font()->set_size(fitted_size);
+  // The fitted size is stored back in the text, so the next paint asks about
+  // that size rather than the original one.
+  fitted_sizes->insert(autoFitKey(*text, size()), fitted_size);
+}
+
+/**
+ * Finds the font size at which text fits within this side.
+ *
+ * Stepping the font size down by AUTOFIT_FONT_ADJUSTMENT until the text fits
+ * stops at the fewest steps for which it fits, and as the extent of the text
+ * only shrinks along with its font, that number of steps can be found with a
+ * binary search instead.
+ *
+ * @return The fitted font size, which is never larger than the text's current
+ * size and is not positive if the text does not fit at any size.
+ */
+auto ScreenTextSide::fittedFontSize(RenderContext* renderer,
+                                    const proto::RenderableText& text)
+    -> float {
+  proto::Font font = text.font();
+  float original_size = font.size();
+  auto fits = [&](int32_t steps) -> bool {
+    float candidate = original_size - AUTOFIT_FONT_ADJUSTMENT * steps;
+    if (candidate <= 0) {
+      return true;
+    }
+    font.set_size(candidate);
+    renderer->setFont(font, size());
+    Size text_extent = getTextExtent(renderer, text.text());
+    return text_extent.width <= size().width &&
+           text_extent.height <= size().height;
+  };
+
+  if (fits(0)) {
+    return original_size;
+  }
+  int32_t too_large = 0;
+  auto fitting = static_cast<int32_t>(
+      std::ceil(original_size / AUTOFIT_FONT_ADJUSTMENT));
+  while (fitting - too_large > 1) {
+    int32_t steps = too_large + (fitting - too_large) / 2;
+    if (fits(steps)) {
+      fitting = steps;
+    } else {
+      too_large = steps;
+    }
   }
+  return original_size - AUTOFIT_FONT_ADJUSTMENT * fitting;
 }
 
-auto ScreenTextSide::bottomText(RenderContext* renderer,
-                                const std::string& text) -> Position {
-  Size text_extent = getTextExtent(renderer, text);
+auto ScreenTextSide::bottomText(const Size& text_extent) -> Position {
   int x = (size().width - text_extent.width) / 2;
   int margin = size().height * TOP_OR_BOTTOM_RATIO;
   int y = size().height - text_extent.height - margin;
   return Position{.x = x, .y = y};
 }
 
-auto ScreenTextSide::centerText(RenderContext* renderer,
-                                const std::string& text) -> Position {
-  Size text_extent = getTextExtent(renderer, text);
+auto ScreenTextSide::centerText(const Size& text_extent) -> Position {
   int x = (size().width - text_extent.width) / 2;
   int y = (size().height - text_extent.height) / 2;
   return Position{.x = x, .y = y};
 }
 
-auto ScreenTextSide::topText(RenderContext* renderer, const std::string& text)
-    -> Position {
-  Size text_extent = getTextExtent(renderer, text);
+auto ScreenTextSide::topText(const Size& text_extent) -> Position {
   int x = (size().width - text_extent.width) / 2;
   int y = size().height * TOP_OR_BOTTOM_RATIO;
   return Position{.x = x, .y = y};
@@ -376,25 +411,70 @@ auto ScreenTextSide::topText(RenderContext* renderer, const std::string& text)
 auto ScreenTextSide::positionText(RenderContext* renderer,
                                   const proto::RenderableText& text)
     -> Position {
-  switch (text.position()) {
+  return positionText(text.position(), getTextExtent(renderer, text.text()));
+}
+
+auto ScreenTextSide::positionText(
+    proto::RenderableText_ScreenPosition position, const Size& text_extent)
+    -> Position {
+  switch (position) {
     case proto::RenderableText_ScreenPosition_FONT_SCREEN_POSITION_BOTTOM:
-      return bottomText(renderer, text.text());
+      return bottomText(text_extent);
       break;
     case proto::RenderableText_ScreenPosition_FONT_SCREEN_POSITION_TOP:
-      return topText(renderer, text.text());
+      return topText(text_extent);
       break;
     case proto::RenderableText_ScreenPosition_FONT_SCREEN_POSITION_CENTERED:
     default:
-      return centerText(renderer, text.text());
+      return centerText(text_extent);
       break;
   }
 }
 
-void ScreenTextSide::renderShadowText(RenderContext* renderer,
-                                      proto::RenderableText* text) {
+/**
+ * Returns the layout of the text at the given index, measuring it again only
+ * if anything it depends on has changed since it was last measured.
+ *
+ * Leaves the renderer's font set to the text's font if a new layout is
+ * measured, and untouched otherwise.
+ */
+auto ScreenTextSide::textLayout(RenderContext* renderer, size_t index)
+    -> const TextLayout& {
+  const proto::RenderableText& text = texts[index];
+  if (text_layouts.size() != texts.size()) {
+    text_layouts.resize(texts.size());
+  }
+  std::optional<TextLayout>& layout = text_layouts[index];
+  if (layout.has_value() && layout->text == text.text() &&
+      layout->font_style == text.font().style() &&
+      layout->font_size == text.font().size() &&
+      layout->position == text.position() && layout->side_size == size()) {
+    return *layout;
+  }
+
+  renderer->setFont(text.font(), size());
+  TextLayout new_layout;
+  new_layout.text = text.text();
+  new_layout.font_style = text.font().style();
+  new_layout.font_size = text.font().size();
+  new_layout.position = text.position();
+  new_layout.side_size = size();
+  new_layout.lines = renderer->textLines(text.text());
+  Size extent{.width = 0, .height = 0};
+  for (const auto& line : new_layout.lines) {
+    extent.width = std::max(extent.width, line.extent.width);
+    extent.height += line.extent.height;
+  }
+  new_layout.placement = positionText(text.position(), extent);
+  layout = new_layout;
+  return *layout;
+}
+
+void ScreenTextSide::renderShadowText(RenderContext* renderer, size_t index) {
   if (singleton->generalConfig()->dropShadowDistance() < 0) {
     return;
   }
+  proto::RenderableText* text = &texts[index];
 
   double drop_shadow_factor =
       singleton->generalConfig()->dropShadowDistance() * text->font().size();
@@ -405,32 +485,34 @@ void ScreenTextSide::renderShadowText(RenderContext* renderer,
   if (auto_fit_text) {
     autoFitText(renderer, text);
   }
+  const TextLayout& layout = textLayout(renderer, index);
   renderer->setFont(text->font(), size());
   Color fontColor = ProtoUtil::wxClr(text->font().color()).contrastColor();
   renderer->setTextColor(fontColor);
-  Position placement = positionText(renderer, *text);
-  placement =
-      placement + Position{.x = drop_shadow_offset, .y = drop_shadow_offset};
+  Position placement =
+      layout.placement +
+      Position{.x = drop_shadow_offset, .y = drop_shadow_offset};
 
-  renderer->drawText(text->text(), placement.x, placement.y);
+  renderer->drawTextLines(layout.lines, placement.x, placement.y);
 }
 
-void ScreenTextSide::renderText(RenderContext* renderer,
-                                proto::RenderableText* text) {
+void ScreenTextSide::renderText(RenderContext* renderer, size_t index) {
+  proto::RenderableText* text = &texts[index];
   if (auto_fit_text) {
     autoFitText(renderer, text);
   }
+  const TextLayout& layout = textLayout(renderer, index);
   renderer->setFont(text->font(), size());
   renderer->setTextColor(ProtoUtil::wxClr(text->font().color()));
-  Position placement = positionText(renderer, *text);
-  renderer->drawText(text->text(), placement.x, placement.y);
+  renderer->drawTextLines(layout.lines, layout.placement.x, layout.placement.y);
 }
 
-void ScreenTextSide::renderTimer(RenderContext* renderer) {
-  // Do nothing if the timer is turned off.
-  if (!singleton->timerManager()->timerOn()) {
+void ScreenTextSide::updateTimerChrome(RenderContext* renderer) {
+  if (timer_chrome.has_value() && timer_chrome->side_size == size()) {
     return;
   }
+  TimerChrome chrome;
+  chrome.side_size = size();
 
   proto::RenderableText timer_text;
   timer_text.set_text("00:00");
@@ -439,27 +521,49 @@ void ScreenTextSide::renderTimer(RenderContext* renderer) {
   ProtoUtil::defaultFont(timer_text.mutable_font());
   timer_text.mutable_font()->set_size(TIMER_FONT_SIZE);
   renderer->setFont(timer_text.font(), size());
-  renderer->setTextColor(Color("white"));
-  Position placement = positionText(renderer, timer_text);
+  chrome.font = timer_text.font();
+  chrome.placement = positionText(renderer, timer_text);
 
   Size shade_size = size();
   shade_size.height = static_cast<int64_t>(
       static_cast<double>(shade_size.height) * TIMER_BACKGROUND_PCT);
-  BackgroundImage shading =
-      BackgroundImage(shade_size, Color("Black"), TIMER_ALPHA);
+  chrome.shading = BackgroundImage(shade_size, Color("Black"), TIMER_ALPHA);
+  chrome.shade_top = static_cast<int64_t>(
+      static_cast<double>(size().height) * (1 - TIMER_BACKGROUND_PCT));
+
+  timer_chrome = chrome;
+}
 
-  renderer->drawImage(shading, 0,
-                      static_cast<int64_t>(static_cast<double>(size().height) *
-                                           (1 - TIMER_BACKGROUND_PCT)),
-                      true);
+void ScreenTextSide::renderTimer(RenderContext* renderer) {
+  // Do nothing if the timer is turned off or a slide is being shown.
+  if (current_slide.has_value() || !singleton->timerManager()->timerOn()) {
+    return;
+  }
+
+  updateTimerChrome(renderer);
+  renderer->drawImage(timer_chrome->shading, 0, timer_chrome->shade_top, true);
+  renderer->setFont(timer_chrome->font, size());
+  renderer->setTextColor(Color("white"));
   std::string curr_time = singleton->timerManager()->displayTime();
-  renderer->drawText(curr_time, placement.x, placement.y);
+  renderer->drawText(curr_time, timer_chrome->placement.x,
+                     timer_chrome->placement.y);
+
+  // Everything above is drawn in a band along the bottom of the side, so a
+  // tick of the timer only needs that band redrawn.
+  int64_t band_top =
+      std::min(timer_chrome->shade_top, timer_chrome->placement.y);
+  compositor.setBounds(
+      static_cast<size_t>(ScreenLayer::Timer), Position{.x = 0, .y = band_top},
+      Size{.width = size().width, .height = size().height - band_top});
 }
 
 void ScreenTextSide::renderAllText(RenderContext* renderer) {
-  for (auto& text : texts) {
-    renderShadowText(renderer, &text);
-    renderText(renderer, &text);
+  if (current_slide.has_value()) {
+    return;
+  }
+  for (size_t i = 0; i < texts.size(); ++i) {
+    renderShadowText(renderer, i);
+    renderText(renderer, i);
   }
 }
 
@@ -468,15 +572,38 @@ auto ScreenTextSide::getTextExtent(RenderContext* renderer,
   return renderer->textExtent(text);
 }
 
+void ScreenTextSide::updateLayerStamps(int64_t now) {
+  std::optional<Image> slide;
+  if (category == ScreenTextCategory::Presenter &&
+      singleton->slideShow()->isRunning()) {
+    slide = singleton->slideShow()->currentSlide(size());
+  }
+  // Entering or leaving a slideshow swaps out the entire stack.
+  if (slide.has_value() != current_slide.has_value()) {
+    compositor.invalidateAll();
+  }
+  current_slide = slide;
+
+  compositor.setStamp(
+      static_cast<size_t>(ScreenLayer::Background),
+      imageStamp(current_slide.has_value() ? *current_slide : image, now));
+  compositor.setStamp(static_cast<size_t>(ScreenLayer::Overlay),
+                      background_overlay.has_value()
+                          ? imageStamp(*background_overlay, now)
+                          : "");
+  compositor.setStamp(
+      static_cast<size_t>(ScreenLayer::Text),
+      std::to_string(singleton->generalConfig()->dropShadowDistance()));
+  compositor.setStamp(static_cast<size_t>(ScreenLayer::Timer),
+                      singleton->timerManager()->timerOn()
+                          ? singleton->timerManager()->displayTime()
+                          : "");
+}
+
 void ScreenTextSide::paintEvent(RenderContext* renderer) {
-  // renderSlide returns true if we're in a slideshow, so abort any other
-  // rendering.
-  if (renderSlide(renderer)) {
-    return;
-  }
-  renderBackground(renderer);
-  renderAllText(renderer);
-  renderTimer(renderer);
+  last_paint_ms = AnimationClock::now();
+  updateLayerStamps(last_paint_ms);
+  compositor.composite(renderer, size(), layer_renderers);
 }
 
 void ScreenTextSide::setImage(const Image& image, bool is_scaled,
@@ -486,6 +613,8 @@ void ScreenTextSide::setImage(const Image& image, bool is_scaled,
     background_color.reset();
     this->image = image;
     background_overlay.reset();
+    compositor.invalidateAll();
+    wakeForAnimation(image);
   }
 };
 
@@ -500,6 +629,7 @@ void ScreenTextSide::setBackground(const Color& color) {
   this->background_color = color;
   initializeForColor(size(), color);
   background_overlay.reset();
+  compositor.invalidateAll();
 };
 
 void ScreenTextSide::setBackgroundOverlay(const Image& overlay,
@@ -512,6 +642,14 @@ void ScreenTextSide::setBackgroundOverlay(const Image& overlay,
     overlay_percentage = overlay_screen_percentage;
     overlay_position = position;
     this->overlay_alpha = overlay_alpha;
+    invalidateLayer(ScreenLayer::Overlay);
+    wakeForAnimation(overlay);
+  }
+}
+
+void ScreenTextSide::wakeForAnimation(const Image& image) {
+  if (image.isOk() && image.isAnimated()) {
+    singleton->autoRefreshTimer()->wake();
   }
 }
 
@@ -533,6 +671,7 @@ void ScreenTextSide::setAll(const ScreenTextSide* source) {
     overlay_alpha = source->overlay_alpha;
     overlay_percentage = source->overlay_percentage;
     overlay_position = source->overlay_position;
+    wakeForAnimation(*background_overlay);
   } else {
     background_overlay.reset();
   }
@@ -542,6 +681,7 @@ void ScreenTextSide::setAll(const ScreenTextSide* source) {
     addText(new_text, this->screen_side);
   }
 
+  compositor.invalidateAll();
   refresh();
 }
 
@@ -555,10 +695,66 @@ auto ScreenTextSide::isSide(const proto::ScreenSide& side) -> bool {
   return (screen_side.extra() && side.extra());
 }
 
-auto ScreenTextSide::ratio(const Size& size) -> float {
-  float ratio = 4 / 3;
-  ratio = static_cast<float>(size.width) / size.height;
-  return ratio;
+auto ScreenTextSide::nextLayerChange(ScreenLayer layer, int64_t after_ms) const
+    -> std::optional<int64_t> {
+  bool showing_slides = category == ScreenTextCategory::Presenter &&
+                        singleton->slideShow()->isRunning();
+  switch (layer) {
+    case ScreenLayer::Background:
+      if (showing_slides) {
+        std::optional<int64_t> next =
+            singleton->slideShow()->nextTransition(after_ms);
+        if (current_slide.has_value() && current_slide->isOk()) {
+          next = AnimationClock::earliest(
+              next, current_slide->nextFrameChange(after_ms));
+        }
+        return next;
+      }
+      if (image.isOk()) {
+        return image.nextFrameChange(after_ms);
+      }
+      return std::nullopt;
+    case ScreenLayer::Overlay:
+      // Nothing else is drawn over a slide.
+      if (showing_slides || !background_overlay.has_value() ||
+          !background_overlay->isOk()) {
+        return std::nullopt;
+      }
+      return background_overlay->nextFrameChange(after_ms);
+    case ScreenLayer::Timer:
+      if (showing_slides || !singleton->timerManager()->timerOn()) {
+        return std::nullopt;
+      }
+      return singleton->timerManager()->nextDisplayChange(after_ms);
+    case ScreenLayer::Text:
+      return std::nullopt;
+  }
+  return std::nullopt;
+}
+
+auto ScreenTextSide::refreshAnimation(int64_t now) -> std::optional<int64_t> {
+  std::optional<int64_t> next;
+  for (size_t i = 0; i < SCREEN_LAYER_COUNT; ++i) {
+    auto layer = static_cast<ScreenLayer>(i);
+    std::optional<int64_t> due = nextLayerChange(layer, last_paint_ms);
+    if (due.has_value() && *due <= now) {
+      refreshLayerArea(layer);
+      // Look past the change which was just refreshed for the next one.
+      due = nextLayerChange(layer, now);
+    }
+    next = AnimationClock::earliest(next, due);
+  }
+  return next;
+}
+
+void ScreenTextSide::refreshLayerArea(ScreenLayer layer) {
+  std::optional<LayerCompositor::Bounds> bounds =
+      compositor.bounds(static_cast<size_t>(layer));
+  if (bounds.has_value()) {
+    refreshRect(bounds->origin, bounds->size);
+  } else {
+    refresh();
+  }
 }
 
 auto ScreenTextSide::hasAnimation() const -> bool {
@@ -20,8 +20,9 @@ limitations under the License.
 
 #include "ui/component/control/ImageFromLibrary.h"
 
-#include <optional>  // for optional
-#include <string>    // for string
+#include <algorithm>  // for any_of
+#include <optional>   // for optional
+#include <string>     // for string
 
 #include "ScoreboardCommon.h"                   // for DEFAULT_BORDER_SIZE
 #include "config/ImageLibrary.h"                // for ImageLibrary, ImageSe...
@@ -171,19 +172,7 @@ void ImageFromLibrary::selectImage(ImagePreview* image) {
     return;
   }
 
-  if (screen_selection->allSelected()) {
-    all_screen_image = Image(*filename);
-    all_screen_image_name = singleton->imageLibrary()->name(*filename);
-    current_image_label->set(all_screen_image_name);
-  } else if (screen_selection->awaySelected()) {
-    away_screen_image = Image(*filename);
-    away_screen_image_name = singleton->imageLibrary()->name(*filename);
-    current_image_label->set(away_screen_image_name);
-  } else {
-    home_screen_image = Image(*filename);
-    home_screen_image_name = singleton->imageLibrary()->name(*filename);
-    current_image_label->set(home_screen_image_name);
-  }
+  loadScreenImage(*filename, singleton->imageLibrary()->name(*filename));
 
   control_panel->update();
   updatePreview();
@@ -239,6 +228,12 @@ void ImageFromLibrary::setImages(const std::string& search,
   }
 }
 
+auto ImageFromLibrary::hasAnimation() const -> bool {
+  return std::any_of(
+      image_previews.begin(), image_previews.end(),
+      [](const auto& preview) { return preview && preview->hasAnimation(); });
+}
+
 void ImageFromLibrary::refresh() const {
   for (const auto& preview : image_previews) {
     if (preview && preview->hasAnimation()) {
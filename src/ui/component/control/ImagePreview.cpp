@@ -21,17 +21,19 @@ limitations under the License.
 
 #include <string>  // for allocator, string
 
-#include "config/Position.h"              // for Size
-#include "config/swx/event.h"             // for wxEVT_PAINT
-#include "ui/graphics/BackgroundImage.h"  // for BackgroundImage
-#include "ui/graphics/Color.h"            // for Color
-#include "ui/widget/RenderContext.h"      // for RenderContext
+#include "config/Position.h"               // for Size
+#include "config/swx/event.h"              // for wxEVT_PAINT
+#include "ui/graphics/BackgroundImage.h"   // for BackgroundImage
+#include "ui/graphics/Color.h"             // for Color
+#include "ui/graphics/ScaledImageCache.h"  // for ScaledImageCache
+#include "ui/widget/RenderContext.h"       // for RenderContext
 
 namespace cszb_scoreboard {
 
 const std::string DEFAULT_PREVIEW_COLOR = "Grey";
 
-ImagePreview::ImagePreview(swx::Panel* wx) : Panel(wx) {
+ImagePreview::ImagePreview(swx::Panel* wx, Singleton* singleton) : Panel(wx) {
+  this->singleton = singleton;
   this->image = BackgroundImage(size(), Color(DEFAULT_PREVIEW_COLOR));
   bindEvents();
 }
@@ -42,40 +44,19 @@ void ImagePreview::bindEvents() {
 }
 
 void ImagePreview::paintEvent(RenderContext* renderer) {
-  Image scaled_image = image;
-  Size image_size = scaled_image.size();
-  float screen_ratio = ratio(size());
-  float image_ratio = ratio(image_size);
-  int image_height;
-  int image_width;
-  if (screen_ratio > image_ratio) {
-    // Screen is wider than image, so make the heights match
-    image_height = size().height;
-    image_width = size().height * image_ratio;
-  } else {
-    // Screen is either the same ratio or narrower than image, so make the
-    // widths match
-    image_width = size().width;
-    image_height = size().width / image_ratio;
-  }
-
-  scaled_image.rescale(image_width, image_height);
-  int x = (size().width - image_width) / 2;
-  int y = (size().height - image_height) / 2;
+  Image scaled_image =
+      singleton->scaledImageCache()->scaledToFit(image, size());
+  int x = (size().width - scaled_image.size().width) / 2;
+  int y = (size().height - scaled_image.size().height) / 2;
 
   renderer->drawImage(BackgroundImage(size(), Color("Black")), 0, 0);
   renderer->drawImage(scaled_image, x, y, /*use_mask=*/true, /*animate=*/false);
 }
 
-auto ImagePreview::ratio(const Size& size) -> float {
-  float ratio = 4 / 3;
-  ratio = static_cast<float>(size.width) / size.height;
-  return ratio;
-}
-
 void ImagePreview::clearImage() {
   image = BackgroundImage(size(), Color(DEFAULT_PREVIEW_COLOR));
   filename.reset();
+  loading.cancel();
   refresh();
 }
 
@@ -88,7 +69,14 @@ void ImagePreview::setImage(const FilesystemPath& filename) {
   // but it avoids a nasty crash.
   if (filename.existsWithRoot("")) {
     this->filename = filename;
-    image = Image(filename);
+    image = BackgroundImage(size(), Color(DEFAULT_PREVIEW_COLOR));
+    // Only ever shown as a thumbnail, so there's no need to decode any more
+    // of the image than fits in one.
+    loading = singleton->imageLoader()->load(
+        filename, size(), [this](const Image& loaded) -> void {
+          image = loaded;
+          refresh();
+        });
   }
   refresh();
 }
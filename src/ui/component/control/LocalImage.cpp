@@ -90,17 +90,7 @@ void LocalImage::browsePressed() {
       openFilePicker("Select Image", IMAGE_SELECTION_STRING);
   std::optional<FilesystemPath> selected_file = dialog->selectFile();
   if (selected_file.has_value()) {
-    if (screen_selection->allSelected()) {
-      all_screen_image = Image(*selected_file);
-      all_screen_image_name = selected_file->filename().string();
-    } else if (screen_selection->awaySelected()) {
-      away_screen_image = Image(*selected_file);
-      away_screen_image_name = selected_file->filename().string();
-    } else {
-      home_screen_image = Image(*selected_file);
-      home_screen_image_name = selected_file->filename().string();
-    }
-    current_image_label->set(selected_file->filename().string());
+    loadScreenImage(*selected_file, selected_file->filename().string());
   }
 
   control_panel->update();
@@ -115,13 +105,18 @@ void LocalImage::pastePressed() {
     return;
   }
 
+  // Cancel any file still loading for this screen, so it can't replace the
+  // pasted image once it's done.
   if (screen_selection->allSelected()) {
+    all_screen_loading.cancel();
     all_screen_image = *clipboard_image;
     all_screen_image_name = CLIPBOARD_IMAGE_MESSAGE;
   } else if (screen_selection->awaySelected()) {
+    away_screen_loading.cancel();
     away_screen_image = *clipboard_image;
     away_screen_image_name = CLIPBOARD_IMAGE_MESSAGE;
   } else {
+    home_screen_loading.cancel();
     home_screen_image = *clipboard_image;
     home_screen_image_name = CLIPBOARD_IMAGE_MESSAGE;
   }
@@ -78,14 +78,14 @@ void ScoreControl::setTeams(const proto::TeamLibraryDialogResponse& teams) {
     home_name_entry->setValue(teams.home().name());
     home_logo_label->set(teams.home().image_path());
     if (!teams.home().image_path().empty()) {
-      home_logo = Image(FilesystemPath(teams.home().image_path()));
+      loadLogo(true, FilesystemPath(teams.home().image_path()));
     }
   }
   if (teams.has_away()) {
     away_name_entry->setValue(teams.away().name());
     away_logo_label->set(teams.away().image_path());
     if (!teams.away().image_path().empty()) {
-      away_logo = Image(FilesystemPath(teams.away().image_path()));
+      loadLogo(false, FilesystemPath(teams.away().image_path()));
     }
   }
   control_panel->update();
@@ -276,11 +276,10 @@ void ScoreControl::selectLogo(bool isHome) {
       openFilePicker("Select Logo Image", LOGO_SELECTION_STRING);
   std::optional<FilesystemPath> selected_file = picker->selectFile();
   if (selected_file.has_value()) {
+    loadLogo(isHome, *selected_file);
     if (isHome) {
-      home_logo = Image(*selected_file);
       home_logo_label->set(selected_file->filename().string());
     } else {
-      away_logo = Image(*selected_file);
       away_logo_label->set(selected_file->filename().string());
     }
   }
@@ -288,6 +287,18 @@ void ScoreControl::selectLogo(bool isHome) {
   updatePreview();
 }
 
+void ScoreControl::loadLogo(bool isHome, const FilesystemPath& file) {
+  std::optional<Image>* logo = isHome ? &home_logo : &away_logo;
+  ImageLoader::Request* loading =
+      isHome ? &home_logo_loading : &away_logo_loading;
+  logo->reset();
+  *loading = singleton->imageLoader()->load(
+      file, [this, logo](const Image& image) -> void {
+        *logo = image;
+        updatePreview();
+      });
+}
+
 auto ScoreControl::scoreLines(bool isHome)
     -> std::vector<proto::RenderableText> {
   std::vector<proto::RenderableText> update;
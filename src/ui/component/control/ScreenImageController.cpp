@@ -23,6 +23,7 @@ limitations under the License.
 #include "ScoreboardCommon.h"
 #include "config/swx/event.h"
 #include "ui/component/ScreenText.h"
+#include "util/FilesystemPath.h"
 #include "ui/graphics/Color.h"
 #include "ui/widget/Panel.h"
 #include "util/ProtoUtil.h"
@@ -72,6 +73,31 @@ void ScreenImageController::updateScreenText(ScreenText* screen_text) {
   }
 }
 
+void ScreenImageController::loadScreenImage(const FilesystemPath& file,
+                                            const std::string& name) {
+  Image* target = &home_screen_image;
+  ImageLoader::Request* loading = &home_screen_loading;
+  if (screen_selection->allSelected()) {
+    target = &all_screen_image;
+    loading = &all_screen_loading;
+    all_screen_image_name = name;
+  } else if (screen_selection->awaySelected()) {
+    target = &away_screen_image;
+    loading = &away_screen_loading;
+    away_screen_image_name = name;
+  } else {
+    home_screen_image_name = name;
+  }
+  current_image_label->set(name);
+
+  *target = Image();
+  *loading = singleton->imageLoader()->load(
+      file, [this, target](const Image& image) -> void {
+        *target = image;
+        updatePreview();
+      });
+}
+
 void ScreenImageController::screenChanged() {
   if (screen_selection->allSelected()) {
     if (all_screen_image_name.empty()) {
@@ -21,17 +21,19 @@ limitations under the License.
 
 #include <wx/event.h>  // for wxCommandEvent (ptr only), wxEVT_C...
 
+#include <algorithm>   // for any_of
 #include <filesystem>  // for path
 #include <optional>    // for optional
 #include <string>      // for string
 
-#include "ScoreboardCommon.h"      // for IMAGE_SELECTION_STRING
-#include "config/SlideShow.h"      // for SlideShow
-#include "slide_show.pb.h"         // for SlideInfo
-#include "ui/widget/FilePicker.h"  // for FilePicker
-#include "util/FilesystemPath.h"   // for FilesystemPath
-#include "util/Singleton.h"        // for Singleton
-#include "util/StringUtil.h"       // for StringUtil
+#include "ScoreboardCommon.h"           // for IMAGE_SELECTION_STRING
+#include "config/SlideShow.h"           // for SlideShow
+#include "slide_show.pb.h"              // for SlideInfo
+#include "ui/event/AutoRefreshTimer.h"  // for AutoRefreshTimer
+#include "ui/widget/FilePicker.h"       // for FilePicker
+#include "util/FilesystemPath.h"        // for FilesystemPath
+#include "util/Singleton.h"             // for Singleton
+#include "util/StringUtil.h"            // for StringUtil
 
 namespace cszb_scoreboard {
 class ScreenText;
@@ -208,11 +210,17 @@ void SlideshowSetup::lastPage() {
 
 void SlideshowSetup::startShow() {
   singleton->slideShow()->start();
-  singleton->autoRefreshTimer();
+  singleton->autoRefreshTimer()->wake();
 }
 
 void SlideshowSetup::stopShow() { singleton->slideShow()->stop(); }
 
+auto SlideshowSetup::hasAnimation() const -> bool {
+  return std::any_of(
+      slide_previews.begin(), slide_previews.end(),
+      [](const auto& preview) { return preview && preview->hasAnimation(); });
+}
+
 void SlideshowSetup::refresh() const {
   for (const auto& preview : slide_previews) {
     if (preview && preview->hasAnimation()) {
@@ -21,7 +21,14 @@ limitations under the License.
 
 #include <wx/event.h>  // for wxCommandEvent (ptr only), wxEVT_C...
 
-#include "config/GeneralConfig.h"  // for GeneralConfig
+#include <cstddef>  // for size_t
+#include <cstdint>  // for int32_t
+#include <string>   // for to_string
+
+#include "config/GeneralConfig.h"          // for GeneralConfig
+#include "ui/graphics/ScaledImageCache.h"  // for ScaledImageCache
+#include "ui/widget/PopUp.h"               // for PopUp
+#include "util/StringUtil.h"               // for StringUtil
 
 namespace cszb_scoreboard {
 
@@ -39,10 +46,15 @@ void GeneralSettingsPage::createControls() {
   enable_drop_shadow = general_settings->checkBox("Enable Drop Shadow");
   enable_drop_shadow->setChecked(
       singleton->generalConfig()->dropShadowDistance() > 0);
+  image_cache_label = general_settings->label("Image Cache (MB)");
+  image_cache_megabytes = general_settings->text(
+      std::to_string(singleton->generalConfig()->imageCacheMegabytes()));
 }
 
 void GeneralSettingsPage::positionWidgets() {
   general_settings->addWidget(*enable_drop_shadow, 0, 0);
+  general_settings->addWidget(*image_cache_label, 1, 0);
+  general_settings->addWidget(*image_cache_megabytes, 1, 1);
   general_settings->runSizer();
 
   addWidget(*general_settings, 0, 0);
@@ -56,14 +68,24 @@ void GeneralSettingsPage::bindEvents() {
 }
 
 auto GeneralSettingsPage::validateSettings() -> bool {
-  // Currently these settings are simple enough they can't really go wrong.
+  if (StringUtil::stringToInt(image_cache_megabytes->value()) < 1) {
+    PopUp::Message("ERROR: The image cache must be at least 1 MB.");
+    return false;
+  }
   return true;
 }
 
 void GeneralSettingsPage::saveSettings() {
   singleton->generalConfig()->setDropShadowDistance(
       enable_drop_shadow->checked() ? DROP_SHADOW_DISTANCE : -1);
+  auto cache_megabytes = static_cast<int32_t>(
+      StringUtil::stringToInt(image_cache_megabytes->value()));
+  singleton->generalConfig()->setImageCacheMegabytes(cache_megabytes);
   singleton->generalConfig()->saveSettings();
+  // Apply the new budget right away, rather than on the next start.
+  singleton->scaledImageCache()->setBudget(
+      static_cast<size_t>(cache_megabytes) *
+      ScaledImageCache::BYTES_PER_MEGABYTE);
 }
 
 void GeneralSettingsPage::dropShadowChanged() {}
@@ -1,6 +1,6 @@
 /*
-ui/event/AutoRefreshTimer.cpp: A timer which forces all of the frames to repaint
-periodically.
+ui/event/AutoRefreshTimer.cpp: A timer which repaints frames on request, and
+which keeps repainting animated content only while there is any on screen.
 
 Copyright 2021-2026 Tracy Beck
 
@@ -19,21 +19,70 @@ limitations under the License.
 
 #include "ui/event/AutoRefreshTimer.h"
 
+#include <cstdint>     // for int64_t
 #include <functional>  // for function
+#include <optional>    // for optional
 
+#include "config/SlideShow.h"           // for SlideShow
 #include "ui/frame/FrameManager.h"      // for FrameManager
 #include "ui/widget/PersistentTimer.h"  // for PersistentTimer
+#include "util/AnimationClock.h"        // for AnimationClock
 
 namespace cszb_scoreboard {
 
-constexpr int REFRESH_RATE_MILLIS = 50;  // 20 hz update frequency
+// How long to wait before checking again on a change which is due, but which
+// has not been painted yet (a window which is hidden won't paint at all).
+constexpr int PENDING_PAINT_MILLIS = 50;
+constexpr int IMMEDIATE_MILLIS = 1;
 
 AutoRefreshTimer::AutoRefreshTimer(Singleton* singleton)
-    : PersistentTimer(REFRESH_RATE_MILLIS,
-                      [this]() -> void { this->execute(); }) {
+    : PersistentTimer([this]() -> void { this->execute(); }) {
   this->singleton = singleton;
 }
 
-void AutoRefreshTimer::execute() { singleton->frameManager()->refreshFrames(); }
+void AutoRefreshTimer::requestRefresh() {
+  full_refresh_requested = true;
+  schedule(IMMEDIATE_MILLIS);
+}
+
+void AutoRefreshTimer::wake() {
+  // Whatever woke us may be due long before the tick we're waiting on (say, a
+  // timer started while a GIF holds a frame for several seconds).  Each tick
+  // works out the next deadline from scratch, so it's safe to tick early.
+  if (!scheduled_for.has_value() ||
+      *scheduled_for > AnimationClock::now() + IMMEDIATE_MILLIS) {
+    schedule(IMMEDIATE_MILLIS);
+  }
+}
+
+void AutoRefreshTimer::schedule(int delay_millis) {
+  scheduled_for = AnimationClock::now() + delay_millis;
+  start(delay_millis, /*one_shot=*/true);
+}
+
+void AutoRefreshTimer::execute() {
+  scheduled_for.reset();
+  if (full_refresh_requested) {
+    full_refresh_requested = false;
+    singleton->frameManager()->refreshFrames();
+  }
+  // Sleep until the next time anything on screen is due to change (a frame of
+  // an animation, a second of a timer, etc.).  If nothing is animated, sleep
+  // until something wakes us back up.
+  int64_t now = AnimationClock::now();
+  // The slide show moves on first, so that screens showing it pick up the new
+  // slide in this same refresh.
+  singleton->slideShow()->advance(now);
+  std::optional<int64_t> next =
+      singleton->frameManager()->refreshAnimations(now);
+  if (!next.has_value()) {
+    return;
+  }
+  if (*next <= now) {
+    schedule(PENDING_PAINT_MILLIS);
+  } else {
+    schedule(static_cast<int>(*next - now));
+  }
+}
 
 }  // namespace cszb_scoreboard
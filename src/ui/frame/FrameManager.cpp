@@ -26,6 +26,7 @@ limitations under the License.
 
 #include "ui/component/ScreenPresenter.h"  // for ScreenPresenter
 #include "ui/widget/Frame.h"               // for Frame
+#include "util/AnimationClock.h"           // for AnimationClock
 
 namespace cszb_scoreboard {
 class ScreenText;
@@ -59,6 +60,17 @@ void FrameManager::refreshFrames() {
   }
 }
 
+auto FrameManager::refreshAnimations(int64_t now) -> std::optional<int64_t> {
+  std::optional<int64_t> next;
+  if (mainView() != nullptr) {
+    next = mainView()->refreshAnimations(now);
+  }
+  for (const auto& frame : frames) {
+    next = AnimationClock::earliest(next, frame->refreshAnimations(now));
+  }
+  return next;
+}
+
 void FrameManager::clearPresenters() { frames.clear(); }
 
 void FrameManager::exitFrames() {
@@ -0,0 +1,450 @@
+/*
+ui/graphics/GifDecoder.cpp: Decodes and composites the frames of an animated
+GIF one at a time, as they are needed, rather than all at once.
+
+Copyright 2026 Tracy Beck
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+*/
+
+#include "ui/graphics/GifDecoder.h"
+
+#include <algorithm>  // for max, min, fill
+#include <array>      // for array
+#include <cstring>    // for memcmp, memcpy
+#include <utility>    // for move
+
+#include "ui/graphics/PixelKernels.h"  // for PixelKernels
+
+namespace cszb_scoreboard {
+
+constexpr int NUM_CHANNELS = 3;
+constexpr size_t HEADER_SIZE = 6;
+constexpr size_t SCREEN_DESCRIPTOR_SIZE = 7;
+constexpr size_t IMAGE_DESCRIPTOR_SIZE = 9;
+constexpr int EXTENSION_INTRODUCER = 0x21;
+constexpr int IMAGE_SEPARATOR = 0x2C;
+constexpr int GRAPHIC_CONTROL_LABEL = 0xF9;
+constexpr int GRAPHIC_CONTROL_SIZE = 4;
+constexpr int PALETTE_FLAG = 0x80;
+constexpr int INTERLACE_FLAG = 0x40;
+constexpr int PALETTE_SIZE_MASK = 0x07;
+constexpr int TRANSPARENCY_FLAG = 0x01;
+constexpr int DISPOSAL_SHIFT = 2;
+constexpr int DISPOSAL_MASK = 0x07;
+constexpr int MILLIS_PER_DELAY_UNIT = 10;
+constexpr int DEFAULT_DELAY_MS = 100;
+constexpr int MAX_CODE_SIZE = 12;
+constexpr int MAX_CODES = 1 << MAX_CODE_SIZE;
+constexpr int MAX_MIN_CODE_SIZE = 8;
+
+GifDecoder::GifDecoder(std::vector<char> data) : data(std::move(data)) {
+  parse();
+  if (!frames.empty()) {
+    clearCanvas();
+  }
+}
+
+auto GifDecoder::isGif(const char* data, size_t size) -> bool {
+  return size >= HEADER_SIZE &&
+         (std::memcmp(data, "GIF87a", HEADER_SIZE) == 0 ||
+          std::memcmp(data, "GIF89a", HEADER_SIZE) == 0);
+}
+
+auto GifDecoder::delay(size_t frame) const -> int {
+  return frame < frames.size() ? frames[frame].delay_ms : 0;
+}
+
+auto GifDecoder::disposal(size_t frame) const -> Disposal {
+  return frame < frames.size() ? frames[frame].disposal
+                               : Disposal::Unspecified;
+}
+
+auto GifDecoder::byte(size_t offset) const -> int {
+  if (offset >= data.size()) {
+    return -1;
+  }
+  return static_cast<unsigned char>(data[offset]);
+}
+
+// GIF stores 16-bit values in little-endian order.
+auto GifDecoder::word(size_t offset) const -> int {
+  return byte(offset) | (byte(offset + 1) << 8);
+}
+
+/* Walks the blocks of the file, recording where each frame's palette and data
+ * are and the graphic control extension which precedes it.  A file which is
+ * truncated or malformed partway through keeps the complete frames before that
+ * point.
+ */
+void GifDecoder::parse() {
+  if (data.size() < HEADER_SIZE + SCREEN_DESCRIPTOR_SIZE ||
+      !isGif(data.data(), data.size())) {
+    return;
+  }
+  canvas_width = word(HEADER_SIZE);
+  canvas_height = word(HEADER_SIZE + 2);
+  if (canvas_width <= 0 || canvas_height <= 0) {
+    return;
+  }
+  int screen_flags = byte(HEADER_SIZE + 4);
+  size_t offset = HEADER_SIZE + SCREEN_DESCRIPTOR_SIZE;
+  size_t global_palette_offset = offset;
+  size_t global_palette_size = 0;
+  if ((screen_flags & PALETTE_FLAG) != 0) {
+    global_palette_size = size_t{2} << (screen_flags & PALETTE_SIZE_MASK);
+    offset += global_palette_size * NUM_CHANNELS;
+  }
+
+  Frame next_frame;
+  while (offset < data.size()) {
+    int block = byte(offset);
+    if (block == EXTENSION_INTRODUCER) {
+      int label = byte(offset + 1);
+      if (label == GRAPHIC_CONTROL_LABEL &&
+          byte(offset + 2) == GRAPHIC_CONTROL_SIZE) {
+        int flags = byte(offset + 3);
+        int disposal = (flags >> DISPOSAL_SHIFT) & DISPOSAL_MASK;
+        // Values past restore-to-previous are reserved, and treated as
+        // unspecified.
+        next_frame.disposal =
+            disposal <= static_cast<int>(Disposal::Previous)
+                ? static_cast<Disposal>(disposal)
+                : Disposal::Unspecified;
+        next_frame.delay_ms = word(offset + 4) * MILLIS_PER_DELAY_UNIT;
+        if ((flags & TRANSPARENCY_FLAG) != 0) {
+          next_frame.transparent_index =
+              static_cast<uint8_t>(byte(offset + 6));
+        }
+      }
+      std::optional<size_t> end = skipSubBlocks(offset + 2);
+      if (!end.has_value()) {
+        break;
+      }
+      offset = *end;
+    } else if (block == IMAGE_SEPARATOR) {
+      if (offset + IMAGE_DESCRIPTOR_SIZE + 1 >= data.size()) {
+        break;
+      }
+      next_frame.x = word(offset + 1);
+      next_frame.y = word(offset + 3);
+      next_frame.width = word(offset + 5);
+      next_frame.height = word(offset + 7);
+      int flags = byte(offset + 9);
+      next_frame.interlaced = (flags & INTERLACE_FLAG) != 0;
+      offset += IMAGE_DESCRIPTOR_SIZE + 1;
+      if ((flags & PALETTE_FLAG) != 0) {
+        next_frame.palette_offset = offset;
+        next_frame.palette_size = size_t{2} << (flags & PALETTE_SIZE_MASK);
+        offset += next_frame.palette_size * NUM_CHANNELS;
+      } else {
+        next_frame.palette_offset = global_palette_offset;
+        next_frame.palette_size = global_palette_size;
+      }
+      int min_code_size = byte(offset);
+      if (min_code_size < 1 || min_code_size > MAX_MIN_CODE_SIZE) {
+        break;
+      }
+      next_frame.min_code_size = static_cast<uint8_t>(min_code_size);
+      next_frame.data_offset = offset + 1;
+      if (next_frame.delay_ms <= 0) {
+        next_frame.delay_ms = DEFAULT_DELAY_MS;
+      }
+      std::optional<size_t> end = skipSubBlocks(next_frame.data_offset);
+      size_t palette_end =
+          next_frame.palette_offset + next_frame.palette_size * NUM_CHANNELS;
+      if (!end.has_value()) {
+        break;
+      }
+      if (palette_end <= data.size()) {
+        frames.push_back(next_frame);
+      }
+      next_frame = Frame();
+      offset = *end;
+    } else {
+      // Either the trailer or something we can't make sense of.
+      break;
+    }
+  }
+}
+
+// Returns the offset just past a chain of data sub-blocks, or nullopt if the
+// data ends before the chain does.
+auto GifDecoder::skipSubBlocks(size_t offset) const -> std::optional<size_t> {
+  while (offset < data.size()) {
+    int length = byte(offset);
+    ++offset;
+    if (length == 0) {
+      return offset;
+    }
+    offset += length;
+  }
+  return std::nullopt;
+}
+
+/* Decompresses the LZW data for a frame into one palette index per pixel, in
+ * the order the rows are stored in the file.  Truncated or corrupt data stops
+ * decoding early, so the result may be shorter than the frame. */
+auto GifDecoder::decompress(const Frame& frame) const -> std::vector<uint8_t> {
+  size_t pixel_count = static_cast<size_t>(frame.width) * frame.height;
+  std::vector<uint8_t> pixels;
+  pixels.reserve(pixel_count);
+
+  const int clear_code = 1 << frame.min_code_size;
+  const int end_code = clear_code + 1;
+  std::array<uint16_t, MAX_CODES> prefix{};
+  std::array<uint8_t, MAX_CODES> suffix{};
+  std::array<uint8_t, MAX_CODES> first{};
+  std::array<uint16_t, MAX_CODES> length{};
+  for (int code = 0; code < clear_code; ++code) {
+    suffix[code] = static_cast<uint8_t>(code);
+    first[code] = static_cast<uint8_t>(code);
+    length[code] = 1;
+  }
+
+  int code_size = frame.min_code_size + 1;
+  int next_code = end_code + 1;
+  int previous = -1;
+
+  size_t offset = frame.data_offset;
+  int block_remaining = 0;
+  uint32_t bits = 0;
+  int bit_count = 0;
+
+  while (pixels.size() < pixel_count) {
+    while (bit_count < code_size) {
+      if (block_remaining == 0) {
+        block_remaining = byte(offset++);
+        if (block_remaining <= 0) {
+          return pixels;
+        }
+      }
+      int next_byte = byte(offset++);
+      if (next_byte < 0) {
+        return pixels;
+      }
+      --block_remaining;
+      bits |= static_cast<uint32_t>(next_byte) << bit_count;
+      bit_count += 8;
+    }
+    int code = static_cast<int>(bits & ((1U << code_size) - 1));
+    bits >>= code_size;
+    bit_count -= code_size;
+
+    if (code == clear_code) {
+      code_size = frame.min_code_size + 1;
+      next_code = end_code + 1;
+      previous = -1;
+      continue;
+    }
+    if (code == end_code) {
+      break;
+    }
+
+    if (previous < 0) {
+      if (code >= clear_code) {
+        break;
+      }
+    } else if (code > next_code) {
+      break;
+    } else if (next_code < MAX_CODES) {
+      // Either way, the new entry is the previous string plus the first pixel
+      // of this one, which for a code not yet in the table (the KwKwK case) is
+      // the first pixel of the previous string.
+      prefix[next_code] = static_cast<uint16_t>(previous);
+      suffix[next_code] = first[code == next_code ? previous : code];
+      first[next_code] = first[previous];
+      length[next_code] = static_cast<uint16_t>(length[previous] + 1);
+      ++next_code;
+      if (next_code == (1 << code_size) && code_size < MAX_CODE_SIZE) {
+        ++code_size;
+      }
+    }
+
+    // Strings are stored back to front, so write this one from its end.
+    size_t start = pixels.size();
+    size_t string_length =
+        std::min<size_t>(length[code], pixel_count - start);
+    pixels.resize(start + string_length);
+    int walk = code;
+    for (size_t skip = length[code]; skip > string_length; --skip) {
+      walk = prefix[walk];
+    }
+    for (size_t i = string_length; i > 0; --i) {
+      pixels[start + i - 1] = suffix[walk];
+      walk = prefix[walk];
+    }
+    previous = code;
+  }
+  return pixels;
+}
+
+void GifDecoder::clearCanvas() {
+  size_t pixel_count = static_cast<size_t>(canvas_width) * canvas_height;
+  canvas_rgb.assign(pixel_count * NUM_CHANNELS, 0);
+  canvas_alpha.assign(pixel_count, 0);
+  composited.reset();
+  saved_area.reset();
+}
+
+auto GifDecoder::composite(size_t frame) -> bool {
+  if (frame >= frames.size()) {
+    return false;
+  }
+  size_t next = 0;
+  if (composited.has_value() && *composited <= frame) {
+    if (*composited == frame) {
+      return true;
+    }
+    dispose(*composited);
+    next = *composited + 1;
+  } else {
+    clearCanvas();
+  }
+  for (size_t i = next; i <= frame; ++i) {
+    if (i > next) {
+      dispose(i - 1);
+    }
+    draw(i);
+  }
+  composited = frame;
+  return true;
+}
+
+void GifDecoder::dispose(size_t frame) {
+  const Frame& disposed = frames[frame];
+  if (disposed.disposal == Disposal::Background) {
+    // Like most browsers, we clear to transparent rather than to the
+    // background color.
+    SavedArea cleared;
+    cleared.frame = frame;
+    int left = std::max(disposed.x, 0);
+    int right = std::min(disposed.x + disposed.width, canvas_width);
+    if (left < right) {
+      cleared.rgb.assign(static_cast<size_t>(right - left) * NUM_CHANNELS, 0);
+      cleared.alpha.assign(static_cast<size_t>(right - left), 0);
+      copyArea(disposed, &cleared, true);
+    }
+  } else if (disposed.disposal == Disposal::Previous &&
+             saved_area.has_value() && saved_area->frame == frame) {
+    copyArea(disposed, &*saved_area, true);
+  }
+  saved_area.reset();
+}
+
+/* Copies the part of the canvas under a frame to or from the given area.  A
+ * restore from an area with only a single row repeats that row, which is how a
+ * frame is cleared without allocating a whole frame's worth of zeros. */
+void GifDecoder::copyArea(const Frame& frame, SavedArea* area, bool restore) {
+  int left = std::max(frame.x, 0);
+  int right = std::min(frame.x + frame.width, canvas_width);
+  int top = std::max(frame.y, 0);
+  int bottom = std::min(frame.y + frame.height, canvas_height);
+  if (left >= right || top >= bottom) {
+    return;
+  }
+  auto row_pixels = static_cast<size_t>(right - left);
+  if (!restore) {
+    area->rgb.resize(row_pixels * (bottom - top) * NUM_CHANNELS);
+    area->alpha.resize(row_pixels * (bottom - top));
+  }
+  size_t area_rows = area->alpha.size() / row_pixels;
+  for (int y = top; y < bottom; ++y) {
+    size_t canvas_index = static_cast<size_t>(y) * canvas_width + left;
+    size_t area_index = (static_cast<size_t>(y - top) % area_rows) * row_pixels;
+    unsigned char* canvas_rgb_row = &canvas_rgb[canvas_index * NUM_CHANNELS];
+    unsigned char* area_rgb_row = &area->rgb[area_index * NUM_CHANNELS];
+    if (restore) {
+      std::memcpy(canvas_rgb_row, area_rgb_row, row_pixels * NUM_CHANNELS);
+      std::memcpy(&canvas_alpha[canvas_index], &area->alpha[area_index],
+                  row_pixels);
+    } else {
+      std::memcpy(area_rgb_row, canvas_rgb_row, row_pixels * NUM_CHANNELS);
+      std::memcpy(&area->alpha[area_index], &canvas_alpha[canvas_index],
+                  row_pixels);
+    }
+  }
+}
+
+void GifDecoder::draw(size_t frame) {
+  const Frame& drawn = frames[frame];
+  if (drawn.disposal == Disposal::Previous) {
+    saved_area = SavedArea();
+    saved_area->frame = frame;
+    copyArea(drawn, &*saved_area, false);
+  }
+
+  std::vector<uint8_t> pixels = decompress(drawn);
+  int left = std::max(drawn.x, 0);
+  int right = std::min(drawn.x + drawn.width, canvas_width);
+  if (left >= right) {
+    return;
+  }
+  auto run = static_cast<size_t>(right - left);
+  const auto* palette = reinterpret_cast<const unsigned char*>(data.data()) +
+                        drawn.palette_offset;
+
+  // Interlaced frames store every eighth row starting from the first, then
+  // every eighth starting from the fifth, then every fourth and every second.
+  constexpr std::array<int, 4> PASS_START = {0, 4, 2, 1};
+  constexpr std::array<int, 4> PASS_STEP = {8, 8, 4, 2};
+  size_t pass = 0;
+  int interlaced_row = 0;
+
+  std::vector<unsigned char> row_rgb(run * NUM_CHANNELS);
+  std::vector<unsigned char> row_alpha(run);
+  for (int stored_row = 0; stored_row < drawn.height; ++stored_row) {
+    int row = stored_row;
+    if (drawn.interlaced) {
+      while (pass < PASS_START.size() &&
+             PASS_START[pass] + interlaced_row * PASS_STEP[pass] >=
+                 drawn.height) {
+        ++pass;
+        interlaced_row = 0;
+      }
+      if (pass >= PASS_START.size()) {
+        break;
+      }
+      row = PASS_START[pass] + interlaced_row * PASS_STEP[pass];
+      ++interlaced_row;
+    }
+
+    size_t source = static_cast<size_t>(stored_row) * drawn.width;
+    int canvas_y = drawn.y + row;
+    if (source >= pixels.size()) {
+      break;
+    }
+    if (canvas_y < 0 || canvas_y >= canvas_height) {
+      continue;
+    }
+    // Expand this row's palette indices, leaving transparent pixels (and any
+    // which weren't decoded) alone when it's blended onto the canvas.
+    for (size_t i = 0; i < run; ++i) {
+      size_t pixel = source + (left - drawn.x) + i;
+      uint8_t index = pixel < pixels.size() ? pixels[pixel] : 0;
+      bool visible = pixel < pixels.size() && index < drawn.palette_size &&
+                     drawn.transparent_index != index;
+      row_alpha[i] = visible ? 255 : 0;
+      if (visible) {
+        std::memcpy(&row_rgb[i * NUM_CHANNELS], &palette[index * NUM_CHANNELS],
+                    NUM_CHANNELS);
+      }
+    }
+    size_t target = static_cast<size_t>(canvas_y) * canvas_width + left;
+    PixelKernels::blend(&canvas_rgb[target * NUM_CHANNELS],
+                        &canvas_alpha[target], row_rgb.data(),
+                        row_alpha.data(), run);
+  }
+}
+
+}  // namespace cszb_scoreboard
@@ -0,0 +1,185 @@
+/*
+ui/graphics/ImageLoader.cpp: Singleton which decodes image files on a small
+pool of background threads, handing the results back on the UI thread.
+
+Copyright 2026 Tracy Beck
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+*/
+
+#include "ui/graphics/ImageLoader.h"
+
+#include <wx/app.h>  // for wxTheApp, wxApp
+
+#include <algorithm>  // for clamp
+
+#include "config/DisplayConfig.h"  // for DisplayConfig
+
+namespace cszb_scoreboard {
+
+// Decoding is mostly memory-bound, and every worker may hold a fully decoded
+// image at once, so there is little to gain from more than a few threads.
+constexpr size_t MAX_THREADS = 4;
+
+auto ImageLoader::Request::operator=(Request&& other) noexcept -> Request& {
+  if (this != &other) {
+    cancel();
+    job = std::move(other.job);
+  }
+  return *this;
+}
+
+auto ImageLoader::Request::isPending() const -> bool {
+  return job && !job->ready && !job->canceled;
+}
+
+auto ImageLoader::Request::isReady() const -> bool {
+  return job && job->ready;
+}
+
+auto ImageLoader::Request::image() const -> std::optional<Image> {
+  if (!isReady()) {
+    return std::nullopt;
+  }
+  return job->decoded;
+}
+
+void ImageLoader::Request::cancel() {
+  if (job) {
+    job->canceled = true;
+    job.reset();
+  }
+}
+
+ImageLoader::ImageLoader(SingletonClass c, size_t threads,
+                         Dispatcher dispatcher, SizeLimit size_limit)
+    : dispatcher(std::move(dispatcher)), size_limit(std::move(size_limit)) {
+  for (size_t i = 0; i < threads; ++i) {
+    workers.emplace_back([this]() -> void { this->work(); });
+  }
+}
+
+ImageLoader::~ImageLoader() {
+  {
+    std::lock_guard<std::mutex> lock(mutex);
+    stopping = true;
+  }
+  wake.notify_all();
+  for (auto& worker : workers) {
+    worker.join();
+  }
+}
+
+auto ImageLoader::load(const FilesystemPath& file, Callback on_loaded)
+    -> Request {
+  auto job = std::make_shared<Job>();
+  job->file = file;
+  if (size_limit) {
+    job->max_size = size_limit();
+  }
+  job->on_loaded = std::move(on_loaded);
+  return queueJob(std::move(job));
+}
+
+auto ImageLoader::load(const FilesystemPath& file, const Size& fit_size,
+                       Callback on_loaded) -> Request {
+  auto job = std::make_shared<Job>();
+  job->file = file;
+  job->fit_size = fit_size;
+  // There's no need to decode any more of the image than will be shown.
+  job->max_size = fit_size;
+  job->on_loaded = std::move(on_loaded);
+  return queueJob(std::move(job));
+}
+
+auto ImageLoader::queueJob(std::shared_ptr<Job> job) -> Request {
+  {
+    std::lock_guard<std::mutex> lock(mutex);
+    queue.push_back(job);
+  }
+  wake.notify_one();
+  return Request(std::move(job));
+}
+
+// GCOVR_EXCL_START - Tests dispatch completions directly, as there is no wxApp.
+auto ImageLoader::defaultThreadCount() -> size_t {
+  // Leave a core for the UI thread.
+  size_t cores = std::thread::hardware_concurrency();
+  return std::clamp<size_t>(cores > 1 ? cores - 1 : 1, 1, MAX_THREADS);
+}
+
+void ImageLoader::postToMainThread(const std::function<void()>& task) {
+  if (wxTheApp != nullptr) {
+    wxTheApp->CallAfter(task);
+  }
+}
+
+auto ImageLoader::largestDisplaySize() -> std::optional<Size> {
+  return Singleton::getInstance()->displayConfig()->largestDisplaySize();
+}
+// GCOVR_EXCL_STOP
+
+// Runs on the UI thread, and delivers every job which has finished so far.
+void ImageLoader::completeJobs() {
+  std::deque<std::shared_ptr<Job>> jobs;
+  {
+    std::lock_guard<std::mutex> lock(mutex);
+    jobs.swap(completed);
+  }
+  for (const auto& job : jobs) {
+    complete(job);
+  }
+}
+
+void ImageLoader::complete(const std::shared_ptr<Job>& job) {
+  if (job->canceled) {
+    return;
+  }
+  job->ready = true;
+  if (job->on_loaded) {
+    job->on_loaded(*job->decoded);
+  }
+}
+
+void ImageLoader::work() {
+  while (true) {
+    std::shared_ptr<Job> job;
+    {
+      std::unique_lock<std::mutex> lock(mutex);
+      wake.wait(lock, [this]() -> bool { return stopping || !queue.empty(); });
+      if (stopping) {
+        return;
+      }
+      job = std::move(queue.front());
+      queue.pop_front();
+    }
+    if (job->canceled) {
+      continue;
+    }
+    job->decoded.emplace(job->file, job->max_size);
+    if (job->fit_size.has_value() && job->decoded->isOk()) {
+      job->decoded = job->decoded->scaledToFit(*job->fit_size);
+    }
+    // wxImage's reference counting isn't thread safe, so this thread must not
+    // hold on to the job (and with it, the image) once it's been handed over.
+    // The dispatched task may be copied and destroyed anywhere, so it only
+    // points back here, and the job itself is collected from completed.
+    {
+      std::lock_guard<std::mutex> lock(mutex);
+      completed.push_back(std::move(job));
+    }
+    dispatcher([this]() -> void { completeJobs(); });
+  }
+}
+
+}  // namespace cszb_scoreboard
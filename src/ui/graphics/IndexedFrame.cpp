@@ -0,0 +1,96 @@
+/*
+ui/graphics/IndexedFrame.cpp: A compact copy of an image's pixels, stored as
+indices into a palette of the colors it uses.
+
+Copyright 2026 Tracy Beck
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+*/
+
+#include "ui/graphics/IndexedFrame.h"
+
+#include <cstdint>        // for uint32_t, uint8_t, UINT8_MAX
+#include <unordered_map>  // for unordered_map
+
+namespace cszb_scoreboard {
+
+constexpr size_t RGB_BYTES = 3;
+
+static auto packColor(const unsigned char* rgb, unsigned char alpha)
+    -> uint32_t {
+  // Every fully transparent pixel looks the same, whatever its color.
+  if (alpha == 0) {
+    return 0;
+  }
+  // NOLINTBEGIN(readability-magic-numbers)
+  return (static_cast<uint32_t>(rgb[0]) << 24) |
+         (static_cast<uint32_t>(rgb[1]) << 16) |
+         (static_cast<uint32_t>(rgb[2]) << 8) | alpha;
+  // NOLINTEND(readability-magic-numbers)
+}
+
+auto IndexedFrame::fromPixels(const unsigned char* rgb,
+                              const unsigned char* alpha, size_t pixel_count)
+    -> std::optional<IndexedFrame> {
+  IndexedFrame frame;
+  frame.indices.resize(pixel_count);
+  std::unordered_map<uint32_t, uint8_t> palette_index;
+  // Neighboring pixels are usually the same color, so check the last one first.
+  std::optional<uint32_t> last_color;
+  uint8_t last_index = 0;
+
+  for (size_t i = 0; i < pixel_count; ++i) {
+    const unsigned char* pixel = rgb + i * RGB_BYTES;
+    unsigned char pixel_alpha = alpha == nullptr ? UINT8_MAX : alpha[i];
+    uint32_t color = packColor(pixel, pixel_alpha);
+    if (color != last_color) {
+      auto entry = palette_index.find(color);
+      if (entry != palette_index.end()) {
+        last_index = entry->second;
+      } else {
+        if (palette_index.size() == MAX_COLORS) {
+          return std::nullopt;
+        }
+        last_index = static_cast<uint8_t>(palette_index.size());
+        palette_index.emplace(color, last_index);
+        if (pixel_alpha == 0) {
+          frame.palette_rgb.insert(frame.palette_rgb.end(), RGB_BYTES, 0);
+        } else {
+          frame.palette_rgb.insert(frame.palette_rgb.end(), pixel,
+                                   pixel + RGB_BYTES);
+        }
+        frame.palette_alpha.push_back(pixel_alpha);
+      }
+      last_color = color;
+    }
+    frame.indices[i] = last_index;
+  }
+  return frame;
+}
+
+void IndexedFrame::expand(unsigned char* rgb, unsigned char* alpha) const {
+  for (size_t i = 0; i < indices.size(); ++i) {
+    size_t index = indices[i];
+    const uint8_t* color = &palette_rgb[index * RGB_BYTES];
+    rgb[i * RGB_BYTES] = color[0];
+    rgb[i * RGB_BYTES + 1] = color[1];
+    rgb[i * RGB_BYTES + 2] = color[2];
+    alpha[i] = palette_alpha[index];
+  }
+}
+
+auto IndexedFrame::bytes() const -> size_t {
+  return indices.size() + palette_rgb.size() + palette_alpha.size();
+}
+
+}  // namespace cszb_scoreboard
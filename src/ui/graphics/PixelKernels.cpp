@@ -0,0 +1,479 @@
+/*
+ui/graphics/PixelKernels.cpp: Bulk per-pixel operations on raw RGB and alpha
+buffers, with SSE2 and AVX2 implementations selected at runtime where the CPU
+supports them.
+
+Copyright 2026 Tracy Beck
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+*/
+
+#include "ui/graphics/PixelKernels.h"
+
+#include <array>    // for array
+#include <atomic>   // for atomic
+#include <cstdint>  // for uint32_t
+#include <cstring>  // for memcpy, memset
+
+#if defined(__x86_64__) || defined(_M_X64) || defined(__i386__) || \
+    defined(_M_IX86)
+#define PIXEL_KERNELS_X86
+#include <immintrin.h>  // IWYU pragma: keep
+#ifdef _MSC_VER
+#include <intrin.h>  // for __cpuid, __cpuidex
+#endif
+#endif
+
+// GCC and Clang only emit vector instructions for functions which ask for
+// them, while MSVC allows any intrinsic anywhere.
+#if defined(__GNUC__) || defined(__clang__)
+#define TARGET_SSE2 __attribute__((target("sse2")))
+#define TARGET_AVX2 __attribute__((target("avx2")))
+#else
+#define TARGET_SSE2
+#define TARGET_AVX2
+#endif
+
+namespace cszb_scoreboard {
+
+constexpr int NUM_CHANNELS = 3;
+constexpr int GREEN_OFFSET = 1;
+constexpr int BLUE_OFFSET = 2;
+constexpr unsigned char OPAQUE_ALPHA = 255;
+constexpr unsigned char TRANSPARENT_ALPHA = 0;
+constexpr unsigned int ALPHA_SCALE = 255;
+constexpr size_t SSE2_PIXELS = 16;
+constexpr size_t AVX2_PIXELS = 32;
+
+/* Blends a single pixel with integer arithmetic.  Each color is weighted by
+ * its premultiplied alpha (scaled by 255 to keep full precision), leaving a
+ * single division per channel:
+ *   out_alpha = fg_a + bg_a * (255 - fg_a) / 255
+ *   out_color = (fg * fg_a * 255 + bg * bg_a * (255 - fg_a)) /
+ *               (fg_a * 255 + bg_a * (255 - fg_a)) */
+static void blendPixel(unsigned char* bg_rgb, unsigned char* bg_alpha,
+                       const unsigned char* fg_rgb, unsigned int alpha) {
+  if (alpha == TRANSPARENT_ALPHA) {
+    return;
+  }
+  if (alpha == OPAQUE_ALPHA) {
+    std::memcpy(bg_rgb, fg_rgb, NUM_CHANNELS);
+    *bg_alpha = OPAQUE_ALPHA;
+    return;
+  }
+  unsigned int fg_weight = alpha * ALPHA_SCALE;
+  unsigned int bg_weight = *bg_alpha * (ALPHA_SCALE - alpha);
+  unsigned int total = fg_weight + bg_weight;
+  for (int channel = 0; channel < NUM_CHANNELS; ++channel) {
+    bg_rgb[channel] = static_cast<unsigned char>(
+        (fg_rgb[channel] * fg_weight + bg_rgb[channel] * bg_weight) / total);
+  }
+  *bg_alpha = static_cast<unsigned char>(total / ALPHA_SCALE);
+}
+
+static void blendPixels(unsigned char* bg_rgb, unsigned char* bg_alpha,
+                        const unsigned char* fg_rgb,
+                        const unsigned char* fg_alpha, size_t begin,
+                        size_t end) {
+  for (size_t i = begin; i < end; ++i) {
+    blendPixel(bg_rgb + i * NUM_CHANNELS, bg_alpha + i,
+               fg_rgb + i * NUM_CHANNELS, fg_alpha[i]);
+  }
+}
+
+static void copyOpaque(unsigned char* bg_rgb, unsigned char* bg_alpha,
+                       const unsigned char* fg_rgb, size_t count) {
+  std::memcpy(bg_rgb, fg_rgb, count * NUM_CHANNELS);
+  std::memset(bg_alpha, OPAQUE_ALPHA, count);
+}
+
+static auto isMasked(const unsigned char* rgb, unsigned char red,
+                     unsigned char green, unsigned char blue) -> bool {
+  return rgb[0] == red && rgb[GREEN_OFFSET] == green &&
+         rgb[BLUE_OFFSET] == blue;
+}
+
+static void maskPixels(const unsigned char* rgb, unsigned char* alpha,
+                       size_t begin, size_t end, unsigned char red,
+                       unsigned char green, unsigned char blue) {
+  for (size_t i = begin; i < end; ++i) {
+    alpha[i] = isMasked(rgb + i * NUM_CHANNELS, red, green, blue)
+                   ? TRANSPARENT_ALPHA
+                   : OPAQUE_ALPHA;
+  }
+}
+
+static void clampPixels(unsigned char* alpha, size_t begin, size_t end,
+                        unsigned char max_alpha) {
+  for (size_t i = begin; i < end; ++i) {
+    if (alpha[i] > max_alpha) {
+      alpha[i] = max_alpha;
+    }
+  }
+}
+
+static void tintPixels(unsigned char* rgb, size_t begin, size_t end,
+                       unsigned char red, unsigned char green,
+                       unsigned char blue) {
+  for (size_t i = begin; i < end; ++i) {
+    rgb[i * NUM_CHANNELS] = red;
+    rgb[i * NUM_CHANNELS + GREEN_OFFSET] = green;
+    rgb[i * NUM_CHANNELS + BLUE_OFFSET] = blue;
+  }
+}
+
+// The given color repeated across enough bytes to cover a full vector block of
+// RGB pixels, so that a block can be compared or filled three vectors at a
+// time.
+static auto colorPattern(unsigned char red, unsigned char green,
+                         unsigned char blue)
+    -> std::array<unsigned char, AVX2_PIXELS * NUM_CHANNELS> {
+  std::array<unsigned char, AVX2_PIXELS * NUM_CHANNELS> pattern{};
+  tintPixels(pattern.data(), 0, AVX2_PIXELS, red, green, blue);
+  return pattern;
+}
+
+/* SSE2 and AVX2 implementations.  Animated GIF frames only ever have fully
+ * opaque or fully transparent pixels, and overlay masks are mostly one or the
+ * other as well, so these look at a block of pixels at a time and handle
+ * uniform blocks in bulk, falling back to the per-pixel code only for blocks
+ * with a mix. */
+
+#ifdef PIXEL_KERNELS_X86
+
+TARGET_SSE2 static void blendSse2(unsigned char* bg_rgb,
+                                  unsigned char* bg_alpha,
+                                  const unsigned char* fg_rgb,
+                                  const unsigned char* fg_alpha, size_t count) {
+  constexpr int ALL_LANES = 0xFFFF;
+  const __m128i transparent = _mm_setzero_si128();
+  const __m128i opaque = _mm_set1_epi8(static_cast<char>(OPAQUE_ALPHA));
+  size_t i = 0;
+  for (; i + SSE2_PIXELS <= count; i += SSE2_PIXELS) {
+    __m128i alpha =
+        _mm_loadu_si128(reinterpret_cast<const __m128i*>(fg_alpha + i));
+    if (_mm_movemask_epi8(_mm_cmpeq_epi8(alpha, transparent)) == ALL_LANES) {
+      continue;
+    }
+    if (_mm_movemask_epi8(_mm_cmpeq_epi8(alpha, opaque)) == ALL_LANES) {
+      copyOpaque(bg_rgb + i * NUM_CHANNELS, bg_alpha + i,
+                 fg_rgb + i * NUM_CHANNELS, SSE2_PIXELS);
+      continue;
+    }
+    blendPixels(bg_rgb, bg_alpha, fg_rgb, fg_alpha, i, i + SSE2_PIXELS);
+  }
+  blendPixels(bg_rgb, bg_alpha, fg_rgb, fg_alpha, i, count);
+}
+
+TARGET_SSE2 static void maskToAlphaSse2(const unsigned char* rgb,
+                                        unsigned char* alpha, size_t count,
+                                        unsigned char red, unsigned char green,
+                                        unsigned char blue) {
+  constexpr int ALL_LANES = 0xFFFF;
+  auto pattern = colorPattern(red, green, blue);
+  const __m128i transparent = _mm_setzero_si128();
+  const __m128i opaque = _mm_set1_epi8(static_cast<char>(OPAQUE_ALPHA));
+  size_t i = 0;
+  for (; i + SSE2_PIXELS <= count; i += SSE2_PIXELS) {
+    const unsigned char* block = rgb + i * NUM_CHANNELS;
+    int all_match = ALL_LANES;
+    int any_match = 0;
+    for (int v = 0; v < NUM_CHANNELS; ++v) {
+      __m128i pixels = _mm_loadu_si128(
+          reinterpret_cast<const __m128i*>(block + v * SSE2_PIXELS));
+      __m128i key = _mm_loadu_si128(
+          reinterpret_cast<const __m128i*>(pattern.data() + v * SSE2_PIXELS));
+      int match = _mm_movemask_epi8(_mm_cmpeq_epi8(pixels, key));
+      all_match &= match;
+      any_match |= match;
+    }
+    auto* out = reinterpret_cast<__m128i*>(alpha + i);
+    if (all_match == ALL_LANES) {
+      _mm_storeu_si128(out, transparent);
+    } else if (any_match == 0) {
+      _mm_storeu_si128(out, opaque);
+    } else {
+      maskPixels(rgb, alpha, i, i + SSE2_PIXELS, red, green, blue);
+    }
+  }
+  maskPixels(rgb, alpha, i, count, red, green, blue);
+}
+
+TARGET_SSE2 static void clampAlphaSse2(unsigned char* alpha, size_t count,
+                                       unsigned char max_alpha) {
+  const __m128i limit = _mm_set1_epi8(static_cast<char>(max_alpha));
+  size_t i = 0;
+  for (; i + SSE2_PIXELS <= count; i += SSE2_PIXELS) {
+    auto* block = reinterpret_cast<__m128i*>(alpha + i);
+    _mm_storeu_si128(block, _mm_min_epu8(_mm_loadu_si128(block), limit));
+  }
+  clampPixels(alpha, i, count, max_alpha);
+}
+
+TARGET_SSE2 static void tintSse2(unsigned char* rgb, size_t count,
+                                 unsigned char red, unsigned char green,
+                                 unsigned char blue) {
+  auto pattern = colorPattern(red, green, blue);
+  const auto* fill = reinterpret_cast<const __m128i*>(pattern.data());
+  size_t i = 0;
+  for (; i + SSE2_PIXELS <= count; i += SSE2_PIXELS) {
+    auto* block = reinterpret_cast<__m128i*>(rgb + i * NUM_CHANNELS);
+    for (int v = 0; v < NUM_CHANNELS; ++v) {
+      _mm_storeu_si128(block + v, _mm_loadu_si128(fill + v));
+    }
+  }
+  tintPixels(rgb, i, count, red, green, blue);
+}
+
+TARGET_AVX2 static void blendAvx2(unsigned char* bg_rgb,
+                                  unsigned char* bg_alpha,
+                                  const unsigned char* fg_rgb,
+                                  const unsigned char* fg_alpha, size_t count) {
+  constexpr uint32_t ALL_LANES = 0xFFFFFFFF;
+  const __m256i transparent = _mm256_setzero_si256();
+  const __m256i opaque = _mm256_set1_epi8(static_cast<char>(OPAQUE_ALPHA));
+  size_t i = 0;
+  for (; i + AVX2_PIXELS <= count; i += AVX2_PIXELS) {
+    __m256i alpha =
+        _mm256_loadu_si256(reinterpret_cast<const __m256i*>(fg_alpha + i));
+    if (static_cast<uint32_t>(_mm256_movemask_epi8(
+            _mm256_cmpeq_epi8(alpha, transparent))) == ALL_LANES) {
+      continue;
+    }
+    if (static_cast<uint32_t>(_mm256_movemask_epi8(
+            _mm256_cmpeq_epi8(alpha, opaque))) == ALL_LANES) {
+      copyOpaque(bg_rgb + i * NUM_CHANNELS, bg_alpha + i,
+                 fg_rgb + i * NUM_CHANNELS, AVX2_PIXELS);
+      continue;
+    }
+    blendPixels(bg_rgb, bg_alpha, fg_rgb, fg_alpha, i, i + AVX2_PIXELS);
+  }
+  blendPixels(bg_rgb, bg_alpha, fg_rgb, fg_alpha, i, count);
+}
+
+TARGET_AVX2 static void maskToAlphaAvx2(const unsigned char* rgb,
+                                        unsigned char* alpha, size_t count,
+                                        unsigned char red, unsigned char green,
+                                        unsigned char blue) {
+  constexpr uint32_t ALL_LANES = 0xFFFFFFFF;
+  auto pattern = colorPattern(red, green, blue);
+  const __m256i transparent = _mm256_setzero_si256();
+  const __m256i opaque = _mm256_set1_epi8(static_cast<char>(OPAQUE_ALPHA));
+  size_t i = 0;
+  for (; i + AVX2_PIXELS <= count; i += AVX2_PIXELS) {
+    const unsigned char* block = rgb + i * NUM_CHANNELS;
+    uint32_t all_match = ALL_LANES;
+    uint32_t any_match = 0;
+    for (int v = 0; v < NUM_CHANNELS; ++v) {
+      __m256i pixels = _mm256_loadu_si256(
+          reinterpret_cast<const __m256i*>(block + v * AVX2_PIXELS));
+      __m256i key = _mm256_loadu_si256(
+          reinterpret_cast<const __m256i*>(pattern.data() + v * AVX2_PIXELS));
+      auto match = static_cast<uint32_t>(
+          _mm256_movemask_epi8(_mm256_cmpeq_epi8(pixels, key)));
+      all_match &= match;
+      any_match |= match;
+    }
+    auto* out = reinterpret_cast<__m256i*>(alpha + i);
+    if (all_match == ALL_LANES) {
+      _mm256_storeu_si256(out, transparent);
+    } else if (any_match == 0) {
+      _mm256_storeu_si256(out, opaque);
+    } else {
+      maskPixels(rgb, alpha, i, i + AVX2_PIXELS, red, green, blue);
+    }
+  }
+  maskPixels(rgb, alpha, i, count, red, green, blue);
+}
+
+TARGET_AVX2 static void clampAlphaAvx2(unsigned char* alpha, size_t count,
+                                       unsigned char max_alpha) {
+  const __m256i limit = _mm256_set1_epi8(static_cast<char>(max_alpha));
+  size_t i = 0;
+  for (; i + AVX2_PIXELS <= count; i += AVX2_PIXELS) {
+    auto* block = reinterpret_cast<__m256i*>(alpha + i);
+    _mm256_storeu_si256(block,
+                        _mm256_min_epu8(_mm256_loadu_si256(block), limit));
+  }
+  clampPixels(alpha, i, count, max_alpha);
+}
+
+TARGET_AVX2 static void tintAvx2(unsigned char* rgb, size_t count,
+                                 unsigned char red, unsigned char green,
+                                 unsigned char blue) {
+  auto pattern = colorPattern(red, green, blue);
+  const auto* fill = reinterpret_cast<const __m256i*>(pattern.data());
+  size_t i = 0;
+  for (; i + AVX2_PIXELS <= count; i += AVX2_PIXELS) {
+    auto* block = reinterpret_cast<__m256i*>(rgb + i * NUM_CHANNELS);
+    for (int v = 0; v < NUM_CHANNELS; ++v) {
+      _mm256_storeu_si256(block + v, _mm256_loadu_si256(fill + v));
+    }
+  }
+  tintPixels(rgb, i, count, red, green, blue);
+}
+
+#ifdef _MSC_VER
+static auto cpuHasSse2() -> bool {
+  constexpr int SSE2_BIT = 26;
+  std::array<int, 4> info{};
+  __cpuid(info.data(), 1);
+  return (info[3] & (1 << SSE2_BIT)) != 0;
+}
+
+static auto cpuHasAvx2() -> bool {
+  constexpr int OSXSAVE_BIT = 27;
+  constexpr int AVX_BIT = 28;
+  constexpr int AVX2_BIT = 5;
+  constexpr unsigned int YMM_STATE = 0x6;
+  std::array<int, 4> info{};
+  __cpuid(info.data(), 0);
+  if (info[0] < 7) {
+    return false;
+  }
+  __cpuid(info.data(), 1);
+  if ((info[2] & (1 << OSXSAVE_BIT)) == 0 || (info[2] & (1 << AVX_BIT)) == 0) {
+    return false;
+  }
+  // The OS must also save the upper halves of the vector registers.
+  if ((_xgetbv(0) & YMM_STATE) != YMM_STATE) {
+    return false;
+  }
+  __cpuidex(info.data(), 7, 0);
+  return (info[1] & (1 << AVX2_BIT)) != 0;
+}
+#else
+static auto cpuHasSse2() -> bool {
+  __builtin_cpu_init();
+  return __builtin_cpu_supports("sse2") != 0;
+}
+
+static auto cpuHasAvx2() -> bool {
+  __builtin_cpu_init();
+  return __builtin_cpu_supports("avx2") != 0;
+}
+#endif  // _MSC_VER
+
+#endif  // PIXEL_KERNELS_X86
+
+static auto detectPath() -> PixelKernels::Path {
+#ifdef PIXEL_KERNELS_X86
+  if (cpuHasAvx2()) {
+    return PixelKernels::Path::AVX2;
+  }
+  if (cpuHasSse2()) {
+    return PixelKernels::Path::SSE2;
+  }
+#endif
+  return PixelKernels::Path::Portable;
+}
+
+static auto activePath() -> std::atomic<PixelKernels::Path>& {
+  static std::atomic<PixelKernels::Path> active(detectPath());
+  return active;
+}
+
+void PixelKernels::blend(unsigned char* bg_rgb, unsigned char* bg_alpha,
+                         const unsigned char* fg_rgb,
+                         const unsigned char* fg_alpha, size_t count) {
+  if (fg_alpha == nullptr) {
+    copyOpaque(bg_rgb, bg_alpha, fg_rgb, count);
+    return;
+  }
+  switch (path()) {
+#ifdef PIXEL_KERNELS_X86
+    case Path::AVX2:
+      blendAvx2(bg_rgb, bg_alpha, fg_rgb, fg_alpha, count);
+      return;
+    case Path::SSE2:
+      blendSse2(bg_rgb, bg_alpha, fg_rgb, fg_alpha, count);
+      return;
+#endif
+    default:
+      blendPixels(bg_rgb, bg_alpha, fg_rgb, fg_alpha, 0, count);
+      return;
+  }
+}
+
+void PixelKernels::maskToAlpha(const unsigned char* rgb, unsigned char* alpha,
+                               size_t count, unsigned char red,
+                               unsigned char green, unsigned char blue) {
+  switch (path()) {
+#ifdef PIXEL_KERNELS_X86
+    case Path::AVX2:
+      maskToAlphaAvx2(rgb, alpha, count, red, green, blue);
+      return;
+    case Path::SSE2:
+      maskToAlphaSse2(rgb, alpha, count, red, green, blue);
+      return;
+#endif
+    default:
+      maskPixels(rgb, alpha, 0, count, red, green, blue);
+      return;
+  }
+}
+
+void PixelKernels::clampAlpha(unsigned char* alpha, size_t count,
+                              unsigned char max_alpha) {
+  switch (path()) {
+#ifdef PIXEL_KERNELS_X86
+    case Path::AVX2:
+      clampAlphaAvx2(alpha, count, max_alpha);
+      return;
+    case Path::SSE2:
+      clampAlphaSse2(alpha, count, max_alpha);
+      return;
+#endif
+    default:
+      clampPixels(alpha, 0, count, max_alpha);
+      return;
+  }
+}
+
+void PixelKernels::tint(unsigned char* rgb, size_t count, unsigned char red,
+                        unsigned char green, unsigned char blue) {
+  switch (path()) {
+#ifdef PIXEL_KERNELS_X86
+    case Path::AVX2:
+      tintAvx2(rgb, count, red, green, blue);
+      return;
+    case Path::SSE2:
+      tintSse2(rgb, count, red, green, blue);
+      return;
+#endif
+    default:
+      tintPixels(rgb, 0, count, red, green, blue);
+      return;
+  }
+}
+
+auto PixelKernels::path() -> Path { return activePath().load(); }
+
+auto PixelKernels::isSupported(Path path) -> bool {
+  switch (path) {
+#ifdef PIXEL_KERNELS_X86
+    case Path::AVX2:
+      return cpuHasAvx2();
+    case Path::SSE2:
+      return cpuHasSse2();
+#endif
+    case Path::Portable:
+      return true;
+    default:
+      return false;
+  }
+}
+
+void PixelKernels::usePath(Path path) { activePath().store(path); }
+
+}  // namespace cszb_scoreboard
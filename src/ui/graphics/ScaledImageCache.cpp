@@ -0,0 +1,77 @@
+/*
+ui/graphics/ScaledImageCache.cpp: Singleton which holds recently scaled copies
+of images, so that every screen showing an image at a given size shares one
+copy.
+
+Copyright 2026 Tracy Beck
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+*/
+
+#include "ui/graphics/ScaledImageCache.h"
+
+#include <functional>  // for hash
+
+#include "config/GeneralConfig.h"  // for GeneralConfig
+
+namespace cszb_scoreboard {
+
+constexpr size_t RGB_BYTES = 3;
+
+auto ScaledImageCache::KeyHash::operator()(const Key& key) const -> size_t {
+  size_t hash = std::hash<uint64_t>()(key.content_id);
+  // NOLINTNEXTLINE(readability-magic-numbers) - Boost's hash_combine constant.
+  constexpr size_t MIX = 0x9e3779b9;
+  for (int64_t value : {key.width, key.height,
+                        static_cast<int64_t>(key.quality)}) {
+    hash ^= std::hash<int64_t>()(value) + MIX + (hash << 6) + (hash >> 2);
+  }
+  return hash;
+}
+
+auto ScaledImageCache::scaledToFit(const Image& image, const Size& target_size,
+                                   wxImageResizeQuality quality) -> Image {
+  if (!image.isOk()) {
+    return image;
+  }
+  Key key{.content_id = image.contentId(),
+          .width = target_size.width,
+          .height = target_size.height,
+          .quality = quality};
+  Image* cached = cache.find(key);
+  if (cached != nullptr) {
+    return *cached;
+  }
+  Image scaled = image.scaledToFit(target_size, quality);
+  // An image which is already the right size comes back as itself, and there's
+  // nothing to gain from holding on to it here.
+  if (scaled.contentId() != image.contentId()) {
+    cache.insert(key, scaled, imageBytes(scaled));
+  }
+  return scaled;
+}
+
+// GCOVR_EXCL_START - Tests set the budget directly.
+auto ScaledImageCache::configuredBudget() -> size_t {
+  return static_cast<size_t>(
+             Singleton::getInstance()->generalConfig()->imageCacheMegabytes()) *
+         BYTES_PER_MEGABYTE;
+}
+// GCOVR_EXCL_STOP
+
+auto ScaledImageCache::imageBytes(const Image& image) -> size_t {
+  auto pixels = static_cast<size_t>(image.size().width * image.size().height);
+  return pixels * (image.alpha() != nullptr ? RGB_BYTES + 1 : RGB_BYTES);
+}
+
+}  // namespace cszb_scoreboard
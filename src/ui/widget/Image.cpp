@@ -21,16 +21,25 @@ limitations under the License.
 #include "ui/widget/Image.h"
 
 #include <wx/gdicmn.h>    // for wxSize, wxPoint, wxBitmapType, wxRect
-#include <wx/gifdecod.h>  // for wxGIFDecoder, wxGIFErrorCode
 #include <wx/mstream.h>   // for wxMemoryInputStream
-#include <wx/wfstream.h>  // for wxFileInputStream
 
-#include <cstring>  // for size_t, memset
-
-#include "ui/graphics/Color.h"    // for Color
-#include "util/FilesystemPath.h"  // for FilesystemPath
-#include "wx/animdecod.h"         // for wxAnimationDisposal
-#include "wx/string.h"            // for wxString
+#include <atomic>       // for atomic
+#include <cstring>      // for size_t, memcmp, memcpy
+#include <functional>   // for hash
+#include <memory>       // for make_shared, shared_ptr
+#include <mutex>        // for lock_guard, mutex
+#include <string_view>  // for string_view
+#include <utility>      // for move
+
+#include "ui/graphics/Color.h"         // for Color
+#include "ui/graphics/GifDecoder.h"    // for GifDecoder
+#include "ui/graphics/IndexedFrame.h"  // for IndexedFrame
+#include "ui/graphics/PixelKernels.h"  // for PixelKernels
+#include "util/AnimationClock.h"       // for AnimationClock
+#include "util/FilesystemPath.h"       // for FilesystemPath
+#include "util/LruCache.h"             // for LruCache
+#include "util/MappedFile.h"           // for MappedFile
+#include "wx/string.h"                 // for wxString
 
 // IWYU pragma: no_include <bits/chrono.h>
 
@@ -53,244 +62,155 @@ static void convertMaskToAlpha(wxImage& image) {
     unsigned char green = image.GetMaskGreen();
     unsigned char blue = image.GetMaskBlue();
     image.InitAlpha();
-    int width = image.GetWidth();
-    int height = image.GetHeight();
     unsigned char* alpha = image.GetAlpha();
     unsigned char* data = image.GetData();
     if (alpha != nullptr && data != nullptr) {
-      constexpr int NUM_CHANNELS = 3;
-      constexpr int GREEN_OFFSET = 1;
-      constexpr int BLUE_OFFSET = 2;
-      constexpr unsigned char OPAQUE_ALPHA = 255;
-      constexpr unsigned char TRANSPARENT_ALPHA = 0;
-
-      for (int i = 0; i < width * height; ++i) {
-        if (data[i * NUM_CHANNELS] == red &&
-            data[i * NUM_CHANNELS + GREEN_OFFSET] == green &&
-            data[i * NUM_CHANNELS + BLUE_OFFSET] == blue) {
-          alpha[i] = TRANSPARENT_ALPHA;
-        } else {
-          alpha[i] = OPAQUE_ALPHA;
-        }
-      }
+      PixelKernels::maskToAlpha(
+          data, alpha,
+          static_cast<size_t>(image.GetWidth()) * image.GetHeight(), red,
+          green, blue);
     }
     image.SetMask(false);
   }
 }
 
-/**
- * Blends a foreground image onto a background image at a given offset.
- *
- * This function performs alpha blending of the foreground image (`fg`) onto
- * the background image (`bg`) at the specified coordinate offset (`x_offset`,
- * `y_offset`). If the background image does not have an alpha channel, one is
- * initialized. The function iterates through each pixel of the foreground image
- * and calculates the composite color using standard alpha blending formulas:
- *   out_alpha = fg_alpha + bg_alpha * (1 - fg_alpha)
- *   out_color = (fg_color * fg_alpha + bg_color * bg_alpha * (1 - fg_alpha)) /
- * out_alpha
- *
- * @param bg_image The destination background image.
- * @param fg_image The source foreground image.
- * @param x_offset The horizontal offset where the foreground image should be
- * drawn.
- * @param y_offset The vertical offset where the foreground image should be
- * drawn.
- */
-static void blendImage(wxImage& bg_image, const wxImage& fg_image, int x_offset,
-                       int y_offset) {
-  int bg_width = bg_image.GetWidth();
-  int bg_height = bg_image.GetHeight();
-  int fg_width = fg_image.GetWidth();
-  int fg_height = fg_image.GetHeight();
-
-  unsigned char* bg_data = bg_image.GetData();
-  unsigned char* bg_alpha = bg_image.GetAlpha();
-  const unsigned char* fg_data = fg_image.GetData();
-  const unsigned char* fg_alpha = fg_image.GetAlpha();
-
-  if (bg_alpha == nullptr) {
-    bg_image.InitAlpha();
-    bg_alpha = bg_image.GetAlpha();
-  }
-
-  constexpr int NUM_CHANNELS = 3;
-  constexpr int GREEN_OFFSET = 1;
-  constexpr int BLUE_OFFSET = 2;
-  constexpr unsigned char OPAQUE_VAL = 255;
-  constexpr float OPAQUE_FLOAT = 255.0F;
-
-  for (int y = 0; y < fg_height; ++y) {
-    int bg_y = y + y_offset;
-    if (bg_y < 0 || bg_y >= bg_height) {
-      continue;
+// Composited animation frames are kept for the most recently shown frames, up
+// to this many bytes per animation.  Earlier frames are composited again from
+// the compressed data if they're needed.  Frames are kept palette-indexed where
+// their colors allow, which is a quarter of the size of the full frame.
+constexpr size_t RECENT_FRAME_BYTES = 32 * 1024 * 1024;
+// Likewise for frames scaled to the sizes the animation is shown at, across all
+// of those sizes.
+constexpr size_t SCALED_FRAME_BYTES = 32 * 1024 * 1024;
+// Frames have three bytes of color and one of alpha per pixel.
+constexpr size_t FRAME_PIXEL_BYTES = 4;
+
+struct Image::Animation {
+  explicit Animation(std::vector<char> data) : decoder(std::move(data)) {
+    for (size_t i = 0; i < decoder.frameCount(); ++i) {
+      delays.push_back(decoder.delay(i));
     }
-    for (int x = 0; x < fg_width; ++x) {
-      int bg_x = x + x_offset;
-      if (bg_x < 0 || bg_x >= bg_width) {
-        continue;
-      }
-
-      int fg_idx = y * fg_width + x;
-      unsigned char alpha =
-          (fg_alpha != nullptr) ? fg_alpha[fg_idx] : OPAQUE_VAL;
-      if (alpha == 0) {
-        continue;
-      }
+  }
 
-      int bg_idx = bg_y * bg_width + bg_x;
-      int fg_rgb_idx = fg_idx * NUM_CHANNELS;
-      int bg_rgb_idx = bg_idx * NUM_CHANNELS;
-
-      if (alpha == OPAQUE_VAL) {
-        bg_data[bg_rgb_idx] = fg_data[fg_rgb_idx];
-        bg_data[bg_rgb_idx + GREEN_OFFSET] = fg_data[fg_rgb_idx + GREEN_OFFSET];
-        bg_data[bg_rgb_idx + BLUE_OFFSET] = fg_data[fg_rgb_idx + BLUE_OFFSET];
-        bg_alpha[bg_idx] = OPAQUE_VAL;
-      } else {
-        float a = static_cast<float>(alpha) / OPAQUE_FLOAT;
-        float bg_a = static_cast<float>(bg_alpha[bg_idx]) / OPAQUE_FLOAT;
-        float out_a = a + bg_a * (1.0F - a);
-
-        bg_data[bg_rgb_idx] = static_cast<unsigned char>(
-            (fg_data[fg_rgb_idx] * a +
-             bg_data[bg_rgb_idx] * bg_a * (1.0F - a)) /
-            out_a);
-        bg_data[bg_rgb_idx + GREEN_OFFSET] = static_cast<unsigned char>(
-            (fg_data[fg_rgb_idx + GREEN_OFFSET] * a +
-             bg_data[bg_rgb_idx + GREEN_OFFSET] * bg_a * (1.0F - a)) /
-            out_a);
-        bg_data[bg_rgb_idx + BLUE_OFFSET] = static_cast<unsigned char>(
-            (fg_data[fg_rgb_idx + BLUE_OFFSET] * a +
-             bg_data[bg_rgb_idx + BLUE_OFFSET] * bg_a * (1.0F - a)) /
-            out_a);
-        bg_alpha[bg_idx] = static_cast<unsigned char>(out_a * OPAQUE_FLOAT);
+  struct ScaledFrameKey {
+    size_t index;
+    int64_t width;
+    int64_t height;
+    wxImageResizeQuality quality;
+
+    auto operator==(const ScaledFrameKey& rhs) const -> bool = default;
+  };
+  struct ScaledFrameKeyHash {
+    auto operator()(const ScaledFrameKey& key) const -> size_t {
+      size_t hash = std::hash<size_t>()(key.index);
+      for (int64_t value :
+           {key.width, key.height, static_cast<int64_t>(key.quality)}) {
+        // NOLINTNEXTLINE(readability-magic-numbers)
+        hash = hash * 31 + std::hash<int64_t>()(value);
       }
+      return hash;
     }
-  }
-}
+  };
+
+  // A composited frame kept for reuse.  Only one of the two is set.
+  struct RecentFrame {
+    std::optional<IndexedFrame> indexed;
+    wxImage image;
+  };
+
+  GifDecoder decoder;
+  std::vector<int> delays;
+  LruCache<size_t, RecentFrame> recent_frames{RECENT_FRAME_BYTES};
+  LruCache<ScaledFrameKey, wxImage, ScaledFrameKeyHash> scaled_frames{
+      SCALED_FRAME_BYTES};
+  std::mutex mutex;
+
+  auto frame(size_t index) -> wxImage;
+  auto scaledFrame(size_t index, const ::cszb_scoreboard::Size& size,
+                   wxImageResizeQuality quality) -> wxImage;
+
+ private:
+  auto compositedFrame(size_t index) -> wxImage;
+};
 
 /**
- * Clears a specific rectangular region of the image to transparent black.
+ * Returns the fully-composited frame at the given index.
  *
- * This is used during GIF playback when a frame's disposal method is "Restore
- * to Background". It sets the alpha channel and the RGB data of the specified
- * rectangle (defined by `pos` and `size`) to 0 (fully transparent black).
+ * Frames are composited by the decoder on demand, which is cheap when moving
+ * forward by a frame at a time, as playback does, and the result is kept in a
+ * small LRU so that other copies of the image showing the same frame don't
+ * composite it again.
  *
- * @param canvas The destination image canvas to modify.
- * @param pos The top-left corner of the region to clear.
- * @param size The width and height of the region to clear.
+ * @param index The index of the frame.
+ * @return A wxImage of the frame, with an alpha channel.
  */
-static void clearFrameToBackground(wxImage& canvas, const wxPoint& pos,
-                                   const wxSize& size) {
-  constexpr int NUM_CHANNELS = 3;
-  constexpr int GREEN_OFFSET = 1;
-  constexpr int BLUE_OFFSET = 2;
-
-  int width = canvas.GetWidth();
-  int height = canvas.GetHeight();
-  unsigned char* alpha = canvas.GetAlpha();
-  unsigned char* data = canvas.GetData();
-  for (int y = 0; y < size.GetHeight(); ++y) {
-    int bg_y = y + pos.y;
-    if (bg_y < 0 || bg_y >= height) {
-      continue;
-    }
-    for (int x = 0; x < size.GetWidth(); ++x) {
-      int bg_x = x + pos.x;
-      if (bg_x < 0 || bg_x >= width) {
-        continue;
-      }
-      int idx = bg_y * width + bg_x;
-      alpha[idx] = 0;
-      data[idx * NUM_CHANNELS] = 0;
-      data[idx * NUM_CHANNELS + GREEN_OFFSET] = 0;
-      data[idx * NUM_CHANNELS + BLUE_OFFSET] = 0;
-    }
-  }
+auto Image::Animation::frame(size_t index) -> wxImage {
+  std::lock_guard<std::mutex> lock(mutex);
+  return compositedFrame(index);
 }
 
 /**
- * Decodes all frames of a GIF animation and composites them based on disposal
- * methods.
+ * Returns the frame at the given index, scaled to the given size.
  *
- * Since GIF frames can be stored as smaller, partial images overlaid on a
- * larger canvas, and since each frame specifies how the previous frame should
- * be disposed of, this function handles the full decoding and rendering of each
- * frame onto a cumulative canvas. It processes:
- * 1. Frame conversion to image and mask-to-alpha conversion.
- * 2. Pre-frame disposal methods from the prior frame (such as restoring to the
- * previous state, clearing to background, or keeping the current frame).
- * 3. Blending the current frame onto the correct canvas state.
- * 4. Storing the final composited frames and their corresponding frame delays.
+ * Frames are only scaled as they're shown, rather than all at once when the
+ * image is rescaled, and the results are kept in an LRU shared by every copy
+ * of the animation, so screens showing it at the same size scale each frame
+ * once between them.
  *
- * @param decoder The active wxGIFDecoder containing the loaded GIF.
- * @param delays Output vector to be populated with the duration (in
- * milliseconds) of each frame.
- * @return A vector of fully-composited wxImage frames ready for playback.
+ * @param index The index of the frame.
+ * @param size The size to scale the frame to.
+ * @param quality The interpolation quality used during resizing.
+ * @return A wxImage of the scaled frame, with an alpha channel.
  */
-static auto decodeAndCompositeGIF(wxGIFDecoder& decoder,
-                                  std::vector<int>& delays)
-    -> std::vector<wxImage> {
-  size_t frame_count = decoder.GetFrameCount();
-  std::vector<wxImage> frames;
-  if (frame_count <= 1) {
-    return frames;
-  }
-
-  std::vector<wxImage> canvas_history;
-  wxSize animation_size = decoder.GetAnimationSize();
-  wxImage current_canvas(animation_size.GetWidth(), animation_size.GetHeight(),
-                         true);
-  current_canvas.InitAlpha();
-  memset(current_canvas.GetAlpha(), 0,
-         animation_size.GetWidth() * animation_size.GetHeight());
-
-  frames.reserve(frame_count);
-  delays.reserve(frame_count);
-  canvas_history.reserve(frame_count);
-
-  constexpr size_t MIN_HISTORY_FOR_PREVIOUS = 2;
-  constexpr int DEFAULT_DELAY_MS = 100;
-
-  for (size_t i = 0; i < frame_count; ++i) {
-    wxImage frame;
-    if (decoder.ConvertToImage(i, &frame)) {
-      convertMaskToAlpha(frame);
-
-      wxImage canvas_to_draw;
-      if (i == 0) {
-        canvas_to_draw = current_canvas.Copy();
-      } else {
-        wxAnimationDisposal prev_disposal = decoder.GetDisposalMethod(i - 1);
-        if (prev_disposal == wxANIM_TOPREVIOUS &&
-            canvas_history.size() >= MIN_HISTORY_FOR_PREVIOUS) {
-          canvas_to_draw = canvas_history[i - MIN_HISTORY_FOR_PREVIOUS].Copy();
-        } else if (prev_disposal == wxANIM_TOBACKGROUND) {
-          canvas_to_draw = canvas_history[i - 1].Copy();
-          clearFrameToBackground(canvas_to_draw,
-                                 decoder.GetFramePosition(i - 1),
-                                 decoder.GetFrameSize(i - 1));
-        } else {
-          canvas_to_draw = canvas_history[i - 1].Copy();
-        }
-      }
-
-      wxPoint pos = decoder.GetFramePosition(i);
-      blendImage(canvas_to_draw, frame, pos.x, pos.y);
-
-      canvas_history.push_back(canvas_to_draw);
-      frames.push_back(canvas_to_draw);
+auto Image::Animation::scaledFrame(size_t index,
+                                   const ::cszb_scoreboard::Size& size,
+                                   wxImageResizeQuality quality) -> wxImage {
+  std::lock_guard<std::mutex> lock(mutex);
+  ScaledFrameKey key{.index = index,
+                     .width = size.width,
+                     .height = size.height,
+                     .quality = quality};
+  wxImage* cached = scaled_frames.find(key);
+  if (cached != nullptr) {
+    return *cached;
+  }
+  wxImage scaled = compositedFrame(index).Scale(
+      static_cast<int>(size.width), static_cast<int>(size.height), quality);
+  scaled_frames.insert(
+      key, scaled,
+      static_cast<size_t>(size.width * size.height) * FRAME_PIXEL_BYTES);
+  return scaled;
+}
 
-      int delay = decoder.GetDelay(i);
-      if (delay <= 0) {
-        delay = DEFAULT_DELAY_MS;
-      }
-      delays.push_back(delay);
-    }
+// Must be called with the mutex held.
+auto Image::Animation::compositedFrame(size_t index) -> wxImage {
+  RecentFrame* cached = recent_frames.find(index);
+  if (cached != nullptr && !cached->indexed.has_value()) {
+    return cached->image;
+  }
+  wxImage image(decoder.width(), decoder.height(), false);
+  image.InitAlpha();
+  if (cached != nullptr) {
+    cached->indexed->expand(image.GetData(), image.GetAlpha());
+    return image;
   }
 
-  return frames;
+  decoder.composite(index);
+  std::memcpy(image.GetData(), decoder.rgb().data(), decoder.rgb().size());
+  std::memcpy(image.GetAlpha(), decoder.alpha().data(),
+              decoder.alpha().size());
+  std::optional<IndexedFrame> indexed =
+      IndexedFrame::fromPixels(decoder.rgb().data(), decoder.alpha().data(),
+                               decoder.alpha().size());
+  if (indexed.has_value()) {
+    size_t bytes = indexed->bytes();
+    recent_frames.insert(index, RecentFrame{.indexed = std::move(indexed)},
+                         bytes);
+  } else {
+    recent_frames.insert(index, RecentFrame{.image = image},
+                         decoder.rgb().size() + decoder.alpha().size());
+  }
+  return image;
 }
 
 Image::Image(const ::cszb_scoreboard::Size& sz, bool clear)
@@ -299,81 +219,155 @@ Image::Image(const ::cszb_scoreboard::Size& sz, bool clear)
 /**
  * Constructs an Image by loading it from a file path.
  *
- * Loads the image data, converts any legacy transparent mask to an alpha
- * channel, and attempts to load it as an animation (such as a GIF) if
- * applicable.
+ * The file is mapped into memory (or read, where mapping isn't possible) once,
+ * and decoded from there by load().
  *
  * @param file The path to the image file.
+ * @param max_size If given, an image larger than this is scaled down to fit
+ * within it as it's loaded.  Otherwise, the image is kept at full resolution.
  */
-Image::Image(const FilesystemPath& file) : _wx(file.string()) {
-  convertMaskToAlpha(_wx);
-  loadAnimation(file);
+Image::Image(const FilesystemPath& file,
+             const std::optional<::cszb_scoreboard::Size>& max_size) {
+  MappedFile contents(file);
+  if (contents.isOk()) {
+    load(contents.data(), contents.size(), max_size);
+  }
 }
 
 /**
  * Constructs an Image from in-memory binary data.
  *
- * Decodes the image from raw binary data, initializes the alpha channel from
- * mask, and checks if the binary data represents an animated GIF. If it is an
- * animation, decodes and composites all frames and initializes the animation
- * timing structure.
- *
  * @param bin_data The binary data of the image.
  */
 Image::Image(const std::vector<char>& bin_data) {
-  if (bin_data.empty()) {
-    return;
+  if (!bin_data.empty()) {
+    load(bin_data.data(), bin_data.size(), std::nullopt);
   }
-  wxMemoryInputStream inputStream(bin_data.data(), bin_data.size());
-  _wx = swx::Image(wxImage(inputStream, wxBITMAP_TYPE_ANY, -1));
-  convertMaskToAlpha(_wx);
-
-  wxMemoryInputStream animation_stream(bin_data.data(), bin_data.size());
-  wxGIFDecoder decoder;
-  if (decoder.LoadGIF(animation_stream) == wxGIF_OK) {
-    std::vector<int> input_delays;
-    std::vector<wxImage> input_frames =
-        decodeAndCompositeGIF(decoder, input_delays);
-    if (!input_frames.empty()) {
-      frames = std::make_shared<std::vector<wxImage>>(input_frames);
-      delays = std::make_shared<std::vector<int>>(input_delays);
-      start_time = std::chrono::duration_cast<std::chrono::milliseconds>(
-                       std::chrono::steady_clock::now().time_since_epoch())
-                       .count();
-    }
+}
+
+/**
+ * Identifies the format of encoded image data from its first few bytes, so
+ * that wxWidgets doesn't need to try each of its handlers in turn.
+ *
+ * @return The matching bitmap type, or wxBITMAP_TYPE_ANY if it isn't one of the
+ * formats we recognize.
+ */
+static auto sniffType(const char* data, size_t size) -> wxBitmapType {
+  auto starts_with = [data, size](const char* magic, size_t magic_size) {
+    return size >= magic_size && std::memcmp(data, magic, magic_size) == 0;
+  };
+  if (starts_with("\x89PNG\r\n\x1a\n", 8)) {
+    return wxBITMAP_TYPE_PNG;
+  }
+  if (starts_with("\xff\xd8\xff", 3)) {
+    return wxBITMAP_TYPE_JPEG;
   }
+  if (starts_with("BM", 2)) {
+    return wxBITMAP_TYPE_BMP;
+  }
+  if (GifDecoder::isGif(data, size)) {
+    return wxBITMAP_TYPE_GIF;
+  }
+  return wxBITMAP_TYPE_ANY;
+}
+
+/**
+ * Derives a still image's content ID from the bytes it was decoded from, so
+ * that each time the same file is loaded (for instance, once for each screen
+ * showing it), the results are recognized as the same image.  Animated images
+ * keep a unique ID, as each copy plays from the moment it was loaded.
+ */
+static auto encodedContentId(
+    const char* data, size_t size,
+    const std::optional<::cszb_scoreboard::Size>& reduced_to) -> uint64_t {
+  // Counted IDs never reach the top bit, so the two kinds can't collide.
+  constexpr uint64_t ENCODED_ID_BIT = uint64_t{1} << 63;
+  auto hash = static_cast<uint64_t>(
+      std::hash<std::string_view>()(std::string_view(data, size)));
+  // The same file reduced to different sizes is a different image.
+  if (reduced_to.has_value()) {
+    // NOLINTNEXTLINE(readability-magic-numbers)
+    int64_t reduced_size = reduced_to->width * 65537 + reduced_to->height;
+    hash ^= std::hash<int64_t>()(reduced_size);
+  }
+  return hash | ENCODED_ID_BIT;
 }
 
 /**
- * Attempts to load and decode a GIF animation from the specified file.
+ * Decodes an image from its encoded bytes in a single pass.
+ *
+ * GIFs are handled by our own decoder, which provides both the static image
+ * (the first frame) and, for animations, the frames to play back, without
+ * wxWidgets decoding the file a second time.  Other formats, and any GIF our
+ * decoder can't make sense of, are decoded by wxWidgets, with any transparent
+ * mask converted to an alpha channel.
  *
- * Opens the file stream, decodes it using wxGIFDecoder, and if successful,
- * populates the animated frame list and delays, initializing the start time
- * for animation playback.
+ * If max_size is given, the image is scaled down to fit within it.  Large
+ * JPEGs, such as photos, are also decoded at reduced resolution to begin with,
+ * which is much faster than decoding every pixel only to discard most of them.
  *
- * @param file The path to the GIF file.
+ * @param data The encoded image.
+ * @param size The length of data, in bytes.
+ * @param max_size The largest size to keep the image at, if any.
  */
-void Image::loadAnimation(const FilesystemPath& file) {
-  if (!file.existsWithRoot("")) {
-    return;
+void Image::load(const char* data, size_t size,
+                 const std::optional<::cszb_scoreboard::Size>& max_size) {
+  wxBitmapType type = sniffType(data, size);
+  if (type == wxBITMAP_TYPE_GIF) {
+    auto decoded =
+        std::make_shared<Animation>(std::vector<char>(data, data + size));
+    if (decoded->decoder.isOk()) {
+      wxImage first_frame = decoded->frame(0);
+      if (decoded->decoder.frameCount() > 1) {
+        // The first frame is also cached by the animation, so keep a separate
+        // copy in case this image is modified.
+        _wx = swx::Image(first_frame.Copy());
+        animation = decoded;
+        start_time = AnimationClock::now();
+        if (max_size.has_value()) {
+          shrinkToFit(*max_size);
+        }
+        return;
+      }
+      _wx = swx::Image(first_frame);
+    }
   }
-  wxFileInputStream stream(file.string());
-  if (!stream.IsOk()) {
+  if (!_wx.IsOk()) {
+    wxImage decoded;
+    if (max_size.has_value() && type == wxBITMAP_TYPE_JPEG) {
+      // libjpeg only reduces by powers of two, so leave room to scale the rest
+      // of the way smoothly.
+      decoded.SetOption(wxIMAGE_OPTION_MAX_WIDTH,
+                        static_cast<int>(max_size->width * 2));
+      decoded.SetOption(wxIMAGE_OPTION_MAX_HEIGHT,
+                        static_cast<int>(max_size->height * 2));
+    }
+    wxMemoryInputStream stream(data, size);
+    decoded.LoadFile(stream, type);
+    _wx = swx::Image(decoded);
+    convertMaskToAlpha(_wx);
+  }
+  if (!_wx.IsOk()) {
     return;
   }
-  wxGIFDecoder decoder;
-  if (decoder.LoadGIF(stream) == wxGIF_OK) {
-    std::vector<int> delaysList;
-    std::vector<wxImage> framesList =
-        decodeAndCompositeGIF(decoder, delaysList);
-    if (!framesList.empty()) {
-      frames = std::make_shared<std::vector<wxImage>>(framesList);
-      delays = std::make_shared<std::vector<int>>(delaysList);
-      start_time = std::chrono::duration_cast<std::chrono::milliseconds>(
-                       std::chrono::steady_clock::now().time_since_epoch())
-                       .count();
-    }
+  bool reduced = max_size.has_value() && shrinkToFit(*max_size);
+  _content_id = encodedContentId(data, size,
+                                 reduced ? max_size : std::nullopt);
+}
+
+/**
+ * Scales the image down to fit within the given size, if it's any larger.
+ *
+ * @param max_size The size to fit the image within.
+ * @return Whether the image was scaled.
+ */
+auto Image::shrinkToFit(const ::cszb_scoreboard::Size& max_size) -> bool {
+  ::cszb_scoreboard::Size current = size();
+  if (current.width <= max_size.width && current.height <= max_size.height) {
+    return false;
   }
+  *this = scaledToFit(max_size, wxIMAGE_QUALITY_HIGH);
+  return true;
 }
 
 auto Image::size() const -> ::cszb_scoreboard::Size {
@@ -381,21 +375,27 @@ auto Image::size() const -> ::cszb_scoreboard::Size {
 }
 
 void Image::color(const Color& color) {
-  wxRect dimensions(wxPoint(0, 0), _wx.GetSize());
-  _wx.SetRGB(dimensions, color.Red(), color.Green(), color.Blue());
+  if (_wx.IsOk()) {
+    // Copies of an image share its pixels, so tint a copy of our own rather
+    // than tinting every other copy along with this one.
+    if (_wx.GetRefData()->GetRefCount() > 1) {
+      _wx = swx::Image(_wx.Copy());
+    }
+    PixelKernels::tint(_wx.GetData(),
+                       static_cast<size_t>(_wx.GetWidth()) * _wx.GetHeight(),
+                       color.Red(), color.Green(), color.Blue());
+  }
+  modified();
 }
 
-auto Image::isAnimated() const -> bool { return frames && !frames->empty(); }
+auto Image::isAnimated() const -> bool { return animation != nullptr; }
 
 /**
  * Retrieves the specific frame of an animation corresponding to the given
  * timestamp.
  *
- * If the image is not animated, returns the static image.
- * Otherwise, calculates the elapsed time since the animation started, takes the
- * remainder relative to the total animation loop duration, and determines which
- * frame should be visible at `current_time_ms` based on individual frame
- * delays.
+ * If the image is not animated, returns the static image.  Otherwise, returns
+ * the frame selected by frameIndex for `current_time_ms`.
  *
  * @param current_time_ms The current timestamp in milliseconds.
  * @return The wxImage frame for the current point in time.
@@ -404,12 +404,33 @@ auto Image::animate(int64_t current_time_ms) const -> wxImage {
   if (!isAnimated()) {
     return _wx;
   }
+  size_t index = frameIndex(current_time_ms);
+  if (frame_size.has_value()) {
+    return animation->scaledFrame(index, *frame_size, frame_quality);
+  }
+  return animation->frame(index);
+}
+
+/**
+ * Determines which frame of an animation is visible at the given timestamp.
+ *
+ * Calculates the elapsed time since the animation started, takes the remainder
+ * relative to the total animation loop duration, and determines which frame
+ * should be visible at `current_time_ms` based on individual frame delays.
+ *
+ * @param current_time_ms The current timestamp in milliseconds.
+ * @return The index of the visible frame, or 0 if the image is not animated.
+ */
+auto Image::frameIndex(int64_t current_time_ms) const -> size_t {
+  if (!isAnimated()) {
+    return 0;
+  }
   int total_duration = 0;
-  for (int delay : *delays) {
+  for (int delay : animation->delays) {
     total_duration += delay;
   }
   if (total_duration <= 0) {
-    return (*frames)[0];
+    return 0;
   }
   int64_t elapsed = current_time_ms - start_time;
   if (elapsed < 0) {
@@ -417,22 +438,116 @@ auto Image::animate(int64_t current_time_ms) const -> wxImage {
   }
   int64_t offset = elapsed % total_duration;
   int sum = 0;
-  for (size_t i = 0; i < delays->size(); ++i) {
-    sum += (*delays)[i];
+  for (size_t i = 0; i < animation->delays.size(); ++i) {
+    sum += animation->delays[i];
     if (offset < sum) {
-      return (*frames)[i];
+      return i;
     }
   }
-  return (*frames).back();
+  return animation->delays.size() - 1;
+}
+
+/**
+ * Determines when the visible frame of an animation next changes.
+ *
+ * Walks the frame delays from the start of the loop containing `after_ms`, in
+ * the same way as frameIndex, and returns the end of the visible frame.
+ *
+ * @param after_ms A timestamp in milliseconds, on the same clock as animate.
+ * @return The first timestamp after `after_ms` at which frameIndex returns a
+ * different frame, or nullopt if the image is not animated.
+ */
+auto Image::nextFrameChange(int64_t after_ms) const -> std::optional<int64_t> {
+  if (!isAnimated() || animation->delays.size() < 2) {
+    return std::nullopt;
+  }
+  int total_duration = 0;
+  for (int delay : animation->delays) {
+    total_duration += delay;
+  }
+  if (total_duration <= 0) {
+    return std::nullopt;
+  }
+  int64_t elapsed = after_ms - start_time;
+  if (elapsed < 0) {
+    elapsed = 0;
+  }
+  int64_t offset = elapsed % total_duration;
+  int64_t loop_start = start_time + elapsed - offset;
+  int sum = 0;
+  for (int delay : animation->delays) {
+    sum += delay;
+    if (offset < sum) {
+      return loop_start + sum;
+    }
+  }
+  return loop_start + total_duration;
+}
+
+/**
+ * Returns a device-dependent bitmap of the static image.
+ *
+ * The conversion from wxImage is a full copy of the pixel data, so the result
+ * is cached for the image's current content and shared with copies made from
+ * it afterwards.
+ *
+ * @return A wxBitmap suitable for drawing to a device context.
+ */
+auto Image::bitmap() const -> wxBitmap {
+  if (!bitmaps) {
+    bitmaps = std::make_shared<BitmapCache>();
+  }
+  if (!bitmaps->still.IsOk() && _wx.IsOk()) {
+    bitmaps->still = wxBitmap(_wx);
+  }
+  return bitmaps->still;
+}
+
+/**
+ * Returns a device-dependent bitmap of the animation frame visible at the
+ * given timestamp, or of the static image if this image is not animated.
+ *
+ * The most recently converted frame is cached, so repeated paints within a
+ * single frame's delay do not convert it again.
+ *
+ * @param current_time_ms The current timestamp in milliseconds.
+ * @return A wxBitmap suitable for drawing to a device context.
+ */
+auto Image::bitmap(int64_t current_time_ms) const -> wxBitmap {
+  if (!isAnimated()) {
+    return bitmap();
+  }
+  if (!bitmaps) {
+    bitmaps = std::make_shared<BitmapCache>();
+  }
+  size_t index = frameIndex(current_time_ms);
+  if (bitmaps->frame_index != index) {
+    bitmaps->frame = wxBitmap(animate(current_time_ms));
+    bitmaps->frame_index = index;
+  }
+  return bitmaps->frame;
+}
+
+auto Image::nextContentId() -> uint64_t {
+  static std::atomic<uint64_t> id_counter{0};
+  return ++id_counter;
+}
+
+/**
+ * Marks the pixel content of this image as changed, detaching it from the
+ * bitmaps cached for its previous content.
+ */
+void Image::modified() {
+  _content_id = nextContentId();
+  bitmaps.reset();
 }
 
 /**
  * Rescales the image (and all of its animation frames, if animated) to the
  * specified dimensions.
  *
- * Resizes the primary static image and, if the image contains animation frames,
- * resizes each frame individually to maintain consistent dimensions across
- * playback.
+ * Resizes the primary static image and, if the image is animated, records the
+ * size so that each frame is scaled to it as it is shown.
  *
  * @param width The target width.
  * @param height The target height.
@@ -443,16 +558,52 @@ auto Image::rescale(int width, int height, wxImageResizeQuality quality)
     -> Image& {
   _wx.Rescale(width, height, quality);
   if (isAnimated()) {
-    auto new_frames = std::make_shared<std::vector<wxImage>>();
-    new_frames->reserve(frames->size());
-    for (const auto& frame : *frames) {
-      new_frames->push_back(frame.Scale(width, height, quality));
-    }
-    frames = new_frames;
+    frame_size = ::cszb_scoreboard::Size{.width = width, .height = height};
+    frame_quality = quality;
   }
+  modified();
   return *this;
 }
 
+/**
+ * Returns a copy of the image scaled to fit within the given size.
+ *
+ * The image's aspect ratio is preserved, so one dimension matches the target
+ * and the other is no larger than it.  An image which is already that size is
+ * returned as-is, keeping any bitmap already converted from it, so images
+ * which were prepared ahead of time cost nothing here.
+ *
+ * @param target_size The size to fit the image within.
+ * @param quality The interpolation quality used during resizing.
+ * @return The scaled image.
+ */
+auto Image::scaledToFit(const ::cszb_scoreboard::Size& target_size,
+                        wxImageResizeQuality quality) const -> Image {
+  ::cszb_scoreboard::Size image_size = size();
+  float target_ratio = static_cast<float>(target_size.width) /
+                       static_cast<float>(target_size.height);
+  float image_ratio = static_cast<float>(image_size.width) /
+                      static_cast<float>(image_size.height);
+  int width;
+  int height;
+  if (target_ratio > image_ratio) {
+    // Target is wider than image, so make the heights match
+    height = static_cast<int>(target_size.height);
+    width = static_cast<int>(target_size.height * image_ratio);
+  } else {
+    // Target is either the same ratio or narrower than image, so make the
+    // widths match
+    width = static_cast<int>(target_size.width);
+    height = static_cast<int>(target_size.width / image_ratio);
+  }
+
+  Image scaled = *this;
+  if (width != image_size.width || height != image_size.height) {
+    scaled.rescale(width, height, quality);
+  }
+  return scaled;
+}
+
 auto Image::isOk() const -> bool { return _wx.IsOk(); }
 
 auto Image::alpha() const -> unsigned char* { return _wx.GetAlpha(); }
@@ -469,18 +620,26 @@ auto Image::blue(int x, int y) const -> unsigned char {
   return _wx.GetBlue(x, y);
 }
 
-void Image::initAlpha() { _wx.InitAlpha(); }
+void Image::initAlpha() {
+  _wx.InitAlpha();
+  modified();
+}
 
-void Image::alpha(unsigned char* alpha) { _wx.SetAlpha(alpha); }
+void Image::alpha(unsigned char* alpha) {
+  _wx.SetAlpha(alpha);
+  modified();
+}
 
 void Image::rgb(const wxRect& rect, unsigned char r, unsigned char g,
                 unsigned char b) {
   _wx.SetRGB(rect, r, g, b);
+  modified();
 }
 
 void Image::rgb(int x, int y, unsigned char r, unsigned char g,
                 unsigned char b) {
   _wx.SetRGB(x, y, r, g, b);
+  modified();
 }
 
 }  // namespace cszb_scoreboard
@@ -0,0 +1,185 @@
+/*
+ui/widget/LayerCompositor.cpp: Retains a stack of rendered layers in an
+off-screen bitmap, so that painting only re-rasterizes the layers whose inputs
+have changed since the previous paint.
+
+Copyright 2026 Tracy Beck
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+*/
+
+#include "ui/widget/LayerCompositor.h"
+
+#include <wx/brush.h>     // for wxBrush
+#include <wx/dcmemory.h>  // for wxMemoryDC
+#include <wx/pen.h>       // for wxTRANSPARENT_PEN
+
+#include <memory>  // for unique_ptr
+
+#include "ui/graphics/Color.h"        // for Color
+#include "ui/widget/RenderContext.h"  // for RenderContext
+
+namespace cszb_scoreboard {
+
+LayerCompositor::LayerCompositor(size_t layer_count) : layers(layer_count) {}
+
+void LayerCompositor::invalidate(size_t layer) {
+  if (layer >= layers.size()) {
+    return;
+  }
+  markDirty(layer);
+  full_damage = true;
+}
+
+void LayerCompositor::markDirty(size_t layer) {
+  layers[layer].dirty = true;
+  if (layer < snapshot_layers) {
+    snapshot_valid = false;
+  }
+}
+
+void LayerCompositor::invalidateAll() { invalidate(0); }
+
+void LayerCompositor::setStamp(size_t layer, const std::string& stamp) {
+  if (layer >= layers.size() || layers[layer].stamp == stamp) {
+    return;
+  }
+  layers[layer].stamp = stamp;
+  if (!layers[layer].bounds.has_value()) {
+    invalidate(layer);
+    return;
+  }
+  markDirty(layer);
+  const Bounds& bounds = *layers[layer].bounds;
+  wxRect area(bounds.origin.toWx(), bounds.size.toWx());
+  damage = damage.has_value() ? damage->Union(area) : area;
+}
+
+void LayerCompositor::setBounds(size_t layer, const Position& origin,
+                                const Size& size) {
+  if (layer < layers.size()) {
+    layers[layer].bounds = Bounds{origin, size};
+  }
+}
+
+auto LayerCompositor::bounds(size_t layer) const -> std::optional<Bounds> {
+  if (layer >= layers.size()) {
+    return std::nullopt;
+  }
+  return layers[layer].bounds;
+}
+
+void LayerCompositor::composite(RenderContext* renderer, const Size& size,
+                                const std::vector<LayerRenderer>& renderers) {
+  if (size.width <= 0 || size.height <= 0) {
+    return;
+  }
+
+  if (!frame.IsOk() || size != frame_size) {
+    frame = wxBitmap(size.toWx());
+    frame_size = size;
+    for (auto& layer : layers) {
+      layer.dirty = true;
+      layer.bounds.reset();
+    }
+    snapshot = wxBitmap();
+    snapshot_layers = 0;
+    snapshot_valid = false;
+    full_damage = true;
+  }
+
+  std::optional<size_t> first_dirty = firstDirtyLayer();
+  if (first_dirty.has_value()) {
+    updateSnapshot(*first_dirty, renderers);
+    renderLayers(&frame, snapshot_valid ? snapshot_layers : 0, layers.size(),
+                 renderers, full_damage ? std::nullopt : damage);
+  }
+  for (auto& layer : layers) {
+    layer.changed = layer.dirty;
+    layer.dirty = false;
+  }
+  damage.reset();
+  full_damage = false;
+
+  renderer->drawBitmap(frame, 0, 0);
+}
+
+auto LayerCompositor::firstDirtyLayer() const -> std::optional<size_t> {
+  for (size_t i = 0; i < layers.size(); ++i) {
+    if (layers[i].dirty) {
+      return i;
+    }
+  }
+  return std::nullopt;
+}
+
+auto LayerCompositor::heldStill(size_t first, size_t last) const -> bool {
+  for (size_t i = first; i < last; ++i) {
+    if (layers[i].changed) {
+      return false;
+    }
+  }
+  return true;
+}
+
+/* Raises the snapshot (or takes a fresh one) to just beneath the first dirty
+ * layer, so that the next change above it can skip everything below.  This is
+ * only done over layers which held still through the last composite, so that
+ * the snapshot isn't redrawn along with a layer which changes on every frame.
+ * A valid snapshot already holds the layers beneath it, so raising it only
+ * draws the layers in between. */
+void LayerCompositor::updateSnapshot(
+    size_t first_dirty, const std::vector<LayerRenderer>& renderers) {
+  size_t base = snapshot_valid ? snapshot_layers : 0;
+  if (first_dirty <= base || !heldStill(base, first_dirty)) {
+    return;
+  }
+  if (!snapshot.IsOk()) {
+    snapshot = wxBitmap(frame_size.toWx());
+  }
+  renderLayers(&snapshot, base, first_dirty, renderers, std::nullopt,
+               /*over_existing=*/snapshot_valid);
+  snapshot_layers = first_dirty;
+  snapshot_valid = true;
+}
+
+void LayerCompositor::renderLayers(wxBitmap* target, size_t first, size_t last,
+                                   const std::vector<LayerRenderer>& renderers,
+                                   const std::optional<wxRect>& clip,
+                                   bool over_existing) const {
+  wxMemoryDC context(*target);
+  if (clip.has_value()) {
+    context.SetClippingRegion(*clip);
+  }
+  std::unique_ptr<RenderContext> renderer = RenderContext::forDC(&context);
+  // A target which already holds the layers beneath first is drawn over as is.
+  if (!over_existing) {
+    if (first > 0) {
+      renderer->drawBitmap(snapshot, 0, 0);
+    } else if (clip.has_value()) {
+      // Clearing ignores clipping, so only paint over the clipped area.
+      context.SetPen(*wxTRANSPARENT_PEN);
+      context.SetBrush(wxBrush(Color("Black")));
+      context.DrawRectangle(*clip);
+    } else {
+      renderer->clear(Color("Black"));
+    }
+  }
+  for (size_t i = first; i < last && i < renderers.size(); ++i) {
+    if (renderers[i]) {
+      renderers[i](renderer.get());
+    }
+  }
+}
+
+}  // namespace cszb_scoreboard
@@ -27,6 +27,14 @@ PersistentTimer::PersistentTimer(int period,
   held->Start(period, false);
 }
 
+PersistentTimer::PersistentTimer(const std::function<void()>& on_tick) {
+  held = new HeldTimer(on_tick);
+}
+
+void PersistentTimer::start(int period, bool one_shot) {
+  held->Start(period, one_shot);
+}
+
 void PersistentTimer::stop() { held->Stop(); }
 
 PersistentTimer::HeldTimer::HeldTimer(const std::function<void()>& on_tick) {
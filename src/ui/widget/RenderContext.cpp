@@ -24,15 +24,16 @@ limitations under the License.
 #include <wx/string.h>   // for wxString
 #include <wx/tokenzr.h>  // for wxStringTokenizer, wxStringTokenizerMode
 
-#include "config.pb.h"          // for Font
-#include "ui/graphics/Color.h"  // for Color
-#include "ui/widget/Image.h"    // for Image
-#include "util/ProtoUtil.h"     // for ProtoUtil
-#include "wx/bitmap.h"          // for wxBitmap
-#include "wx/brush.h"           // IWYU pragma: keep for wxBrush
-#include "wx/colour.h"          // for wxColor, wxColour
-#include "wx/gdicmn.h"          // for wxTRANSPARENT_PEN, wxWHITE
-#include "wx/pen.h"             // IWYU pragma: keep for wxPen
+#include "config.pb.h"            // for Font
+#include "ui/graphics/Color.h"    // for Color
+#include "ui/widget/Image.h"      // for Image
+#include "util/AnimationClock.h"  // for AnimationClock
+#include "util/ProtoUtil.h"       // for ProtoUtil
+#include "wx/bitmap.h"            // for wxBitmap
+#include "wx/brush.h"             // IWYU pragma: keep for wxBrush
+#include "wx/colour.h"            // for wxColor, wxColour
+#include "wx/gdicmn.h"            // for wxTRANSPARENT_PEN, wxWHITE
+#include "wx/pen.h"               // IWYU pragma: keep for wxPen
 
 // IWYU pragma: no_include <bits/chrono.h>
 // IWYU pragma: no_include "wx/gtk/brush.h"
@@ -94,22 +95,29 @@ void RenderContext::clear(const Color& color) {
   });
 }
 
+void RenderContext::drawBitmap(const wxBitmap& bitmap, int64_t x, int64_t y) {
+  wxDC* context = activeContext();
+  if (context != nullptr) {
+    context->DrawBitmap(bitmap, x, y);
+  }
+}
+
 void RenderContext::drawImage(const Image& image, int64_t x, int64_t y,
                               bool use_mask, bool animate) {
-  runAgainstActiveContext(
-      [image, x, y, use_mask, animate](wxDC* context) -> void {
-        if (image.isAnimated() && animate) {
-          auto now = std::chrono::duration_cast<std::chrono::milliseconds>(
-                         std::chrono::steady_clock::now().time_since_epoch())
-                         .count();
-          context->DrawBitmap(wxBitmap(image.animate(now)), x, y, use_mask);
-        } else {
-          context->DrawBitmap(wxBitmap(image.wx()), x, y, use_mask);
-          if (image.isAnimated() && !animate) {
-            drawGifStamp(context, Position{x, y}, image.size());
-          }
-        }
-      });
+  // This is called for every layer of every paint, so it draws directly rather
+  // than copying the image into a lambda.
+  wxDC* context = activeContext();
+  if (context == nullptr) {
+    return;
+  }
+  if (image.isAnimated() && animate) {
+    context->DrawBitmap(image.bitmap(AnimationClock::now()), x, y, use_mask);
+  } else {
+    context->DrawBitmap(image.bitmap(), x, y, use_mask);
+    if (image.isAnimated() && !animate) {
+      drawGifStamp(context, Position{x, y}, image.size());
+    }
+  }
 }
 
 void RenderContext::drawLine(const Position& start, const Position& end) {
@@ -123,6 +131,20 @@ void RenderContext::drawText(const std::string& text, int64_t x, int64_t y) {
       [text, x, y](wxDC* context) -> void { context->DrawText(text, x, y); });
 }
 
+void RenderContext::drawTextLines(const std::vector<TextLine>& lines,
+                                  int64_t x, int64_t y) {
+  wxDC* context = activeContext();
+  if (context == nullptr) {
+    return;
+  }
+  for (const auto& line : lines) {
+    if (!line.text.empty()) {
+      context->DrawText(line.text, x, y);
+    }
+    y += line.extent.height;
+  }
+}
+
 void RenderContext::setFont(const proto::Font& font, const Size& font_size) {
   runAgainstActiveContext([font, font_size](wxDC* context) -> void {
     context->SetFont(ProtoUtil::wxScaledFont(font, font_size));
@@ -141,30 +163,41 @@ void RenderContext::setTextColor(const Color& color) {
 }
 
 auto RenderContext::textExtent(const std::string& text) -> Size {
+  int64_t width = 0;
+  int64_t height = 0;
+  for (const auto& line : textLines(text)) {
+    if (line.extent.width > width) {
+      width = line.extent.width;
+    }
+    height += line.extent.height;
+  }
+
+  return Size{.width = width, .height = height};
+}
+
+auto RenderContext::textLines(const std::string& text)
+    -> std::vector<TextLine> {
+  std::vector<TextLine> lines;
   wxStringTokenizer tokens(text, "\n\r", wxTOKEN_RET_EMPTY_ALL);
-  int width = 0;
-  int height = 0;
   while (tokens.HasMoreTokens()) {
     wxString token = tokens.GetNextToken();
+    TextLine line{.text = token.ToStdString(), .extent = Size{}};
     if (token.IsEmpty()) {
       // If the line is empty, the vertical extent reads as 0, when it should be
       // the constant height of a character.  So put a thin character here to
       // get the correct vertical extent.
       token = "|";
     }
-    int line_width;
-    int line_height;
+    int line_width = 0;
+    int line_height = 0;
     runAgainstActiveContext(
         [token, &line_width, &line_height](wxDC* context) -> void {
           context->GetTextExtent(token, &line_width, &line_height);
         });
-    if (line_width > width) {
-      width = line_width;
-    }
-    height += line_height;
+    line.extent = Size{.width = line_width, .height = line_height};
+    lines.push_back(line);
   }
-
-  return Size{.width = width, .height = height};
+  return lines;
 }
 
 /* Gets a render context for a widget during a paint event.  This is the most
@@ -195,16 +228,24 @@ auto RenderContext::forDC(wxDC* dc) -> std::unique_ptr<RenderContext> {
   return renderer;
 }
 
+auto RenderContext::activeContext() -> wxDC* {
+  if (raw_context != nullptr) {
+    return raw_context;
+  }
+  if (event_context != nullptr) {
+    return event_context.get();
+  }
+  // If neither of the above is true and this is null, the behavior of callers
+  // is undefined.
+  return generic_context.get();
+}
+
 void RenderContext::runAgainstActiveContext(
     const std::function<void(wxDC*)>& lambda) {
-  if (raw_context != nullptr) {
-    lambda(raw_context);
-  } else if (event_context != nullptr) {
-    lambda(event_context.get());
-  } else if (generic_context != nullptr) {
-    lambda(generic_context.get());
+  wxDC* context = activeContext();
+  if (context != nullptr) {
+    lambda(context);
   }
-  // If neither of the above is true, this behavior is undefined.
 }
 
 }  // namespace cszb_scoreboard
@@ -0,0 +1,60 @@
+/*
+util/AnimationClock.cpp: Utilities for scheduling repaints of animated content
+against a single monotonic clock.
+
+Copyright 2026 Tracy Beck
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+*/
+
+#include "util/AnimationClock.h"
+
+#include <chrono>  // for milliseconds, duration_cast, steady_clock, syst...
+
+// IWYU pragma: no_include <bits/chrono.h>
+
+namespace cszb_scoreboard {
+
+static auto systemNow() -> int64_t {
+  return std::chrono::duration_cast<std::chrono::milliseconds>(
+             std::chrono::system_clock::now().time_since_epoch())
+      .count();
+}
+
+auto AnimationClock::now() -> int64_t {
+  return std::chrono::duration_cast<std::chrono::milliseconds>(
+             std::chrono::steady_clock::now().time_since_epoch())
+      .count();
+}
+
+auto AnimationClock::fromSystemMillis(int64_t system_millis) -> int64_t {
+  return system_millis - systemNow() + now();
+}
+
+auto AnimationClock::toSystemMillis(int64_t steady_millis) -> int64_t {
+  return steady_millis - now() + systemNow();
+}
+
+auto AnimationClock::earliest(std::optional<int64_t> a,
+                              std::optional<int64_t> b)
+    -> std::optional<int64_t> {
+  if (!a.has_value()) {
+    return b;
+  }
+  if (!b.has_value()) {
+    return a;
+  }
+  return *a < *b ? a : b;
+}
+
+}  // namespace cszb_scoreboard
@@ -0,0 +1,129 @@
+/*
+util/MappedFile.cpp: Read-only access to the contents of a file, memory-mapped
+where the platform allows it.
+
+Copyright 2026 Tracy Beck
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+*/
+
+#include "util/MappedFile.h"
+
+#include <fstream>   // for ifstream
+#include <iterator>  // for istreambuf_iterator
+
+#include "util/FilesystemPath.h"  // for FilesystemPath
+
+#ifdef _WIN32
+#include <windows.h>  // for CreateFileW, CreateFileMappingW, MapViewOfFile
+#else
+#include <fcntl.h>     // for open, O_CLOEXEC, O_RDONLY
+#include <sys/mman.h>  // for mmap, munmap
+#include <sys/stat.h>  // for fstat
+#include <unistd.h>    // for close
+#endif
+
+namespace cszb_scoreboard {
+
+MappedFile::MappedFile(const FilesystemPath& path) {
+  map(path);
+  if (!ok) {
+    read(path);
+  }
+}
+
+#ifdef _WIN32
+
+void MappedFile::map(const FilesystemPath& path) {
+  // FilesystemPath is a std::filesystem::path here, so this is already the
+  // wide path, with no lossy trip through a narrow string.
+  HANDLE file = CreateFileW(path.c_str(), GENERIC_READ, FILE_SHARE_READ,
+                            nullptr, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL,
+                            nullptr);
+  if (file == INVALID_HANDLE_VALUE) {
+    return;
+  }
+  LARGE_INTEGER file_size;
+  if (GetFileSizeEx(file, &file_size) == 0 || file_size.QuadPart <= 0) {
+    CloseHandle(file);
+    return;
+  }
+  HANDLE mapping =
+      CreateFileMappingW(file, nullptr, PAGE_READONLY, 0, 0, nullptr);
+  CloseHandle(file);
+  if (mapping == nullptr) {
+    return;
+  }
+  // The view keeps the mapping (and the file) open until it is unmapped.
+  view = MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0);
+  CloseHandle(mapping);
+  if (view == nullptr) {
+    return;
+  }
+  contents = static_cast<const char*>(view);
+  length = static_cast<size_t>(file_size.QuadPart);
+  ok = true;
+}
+
+MappedFile::~MappedFile() {
+  if (view != nullptr) {
+    UnmapViewOfFile(view);
+  }
+}
+
+#else  // #ifdef _WIN32
+
+void MappedFile::map(const FilesystemPath& path) {
+  int file = open(path.c_str(), O_RDONLY | O_CLOEXEC);
+  if (file < 0) {
+    return;
+  }
+  struct stat file_stat {};
+  if (fstat(file, &file_stat) != 0 || file_stat.st_size <= 0) {
+    close(file);
+    return;
+  }
+  void* mapped = mmap(nullptr, static_cast<size_t>(file_stat.st_size),
+                      PROT_READ, MAP_PRIVATE, file, 0);
+  // The mapping remains valid after the descriptor is closed.
+  close(file);
+  if (mapped == MAP_FAILED) {
+    return;
+  }
+  view = mapped;
+  contents = static_cast<const char*>(view);
+  length = static_cast<size_t>(file_stat.st_size);
+  ok = true;
+}
+
+MappedFile::~MappedFile() {
+  if (view != nullptr) {
+    munmap(view, length);
+  }
+}
+
+#endif  // #ifdef _WIN32
+
+void MappedFile::read(const FilesystemPath& path) {
+  std::ifstream stream(path.string(), std::ios::binary);
+  if (!stream.is_open()) {
+    return;
+  }
+  buffer.assign(std::istreambuf_iterator<char>(stream),
+                std::istreambuf_iterator<char>());
+  contents = buffer.data();
+  length = buffer.size();
+  ok = true;
+}
+
+}  // namespace cszb_scoreboard
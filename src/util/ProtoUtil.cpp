@@ -21,13 +21,20 @@ limitations under the License.
 
 #include <wx/font.h>  // for wxFontInfo, wxFont, wxFontFamily
 
+#include <cstddef>  // for size_t
+#include <cstdint>  // for int64_t, uint32_t
+
 #include "util/FontUtil.h"  // for FontUtil
+#include "util/LruCache.h"  // for LruCache
 #include "wx/gdicmn.h"      // for wxRect
 
 namespace cszb_scoreboard {
 struct Size;
 
 const float DEFAULT_FONT_SIZE = 10;
+// Enough for every distinct size on a busy screen and all of its previews.
+constexpr size_t FONT_CACHE_SIZE = 64;
+constexpr int FONT_KEY_STYLE_SHIFT = 32;
 
 auto ProtoUtil::protoRct(const wxRect& input, proto::Rectangle* output)
     -> proto::Rectangle* {
@@ -57,6 +64,19 @@ auto ProtoUtil::wxScaledFont(const proto::Font& input, const Size& scale_size)
     -> wxFont {
   int scaled_size = FontUtil::scaleFactor(scale_size, input.size());
 
+  // Creating a font means a face lookup in the platform's font system, which is
+  // far too slow to repeat for every line of text in every paint.  wxFont is
+  // reference counted, so handing out copies of a cached font is cheap.  This
+  // is deliberately never destroyed, so that no font outlives wxWidgets itself.
+  static auto* font_cache = new LruCache<int64_t, wxFont>(FONT_CACHE_SIZE);
+  // Every font is antialiased, so the style and size are a complete key.
+  int64_t key = (static_cast<int64_t>(input.style()) << FONT_KEY_STYLE_SHIFT) |
+                static_cast<uint32_t>(scaled_size);
+  wxFont* cached = font_cache->find(key);
+  if (cached != nullptr) {
+    return *cached;
+  }
+
   wxFontInfo font_info(scaled_size);
 
   switch (input.style()) {
@@ -77,7 +97,7 @@ auto ProtoUtil::wxScaledFont(const proto::Font& input, const Size& scale_size)
       font.SetPointSize(scaled_size);
     }
   }
-  return font;
+  return *font_cache->insert(key, font);
 }
 
 void ProtoUtil::setFontColor(proto::Font* font, const Color& color) {
@@ -32,11 +32,13 @@ limitations under the License.
 #include "config/SlideShow.h"
 #include "config/TeamConfig.h"  // for TeamConfig
 #include "ui/event/AutoRefreshTimer.h"
-#include "ui/frame/FrameManager.h"   // for FrameManager
-#include "ui/frame/HotkeyTable.h"    // for HotkeyTable
-#include "ui/graphics/TeamColors.h"  // for TeamColors
-#include "util/AutoUpdate.h"         // for AutoUpdate
-#include "util/TimerManager.h"       // for TimerManager
+#include "ui/frame/FrameManager.h"         // for FrameManager
+#include "ui/frame/HotkeyTable.h"          // for HotkeyTable
+#include "ui/graphics/ImageLoader.h"       // for ImageLoader
+#include "ui/graphics/ScaledImageCache.h"  // for ScaledImageCache
+#include "ui/graphics/TeamColors.h"        // for TeamColors
+#include "util/AutoUpdate.h"               // for AutoUpdate
+#include "util/TimerManager.h"             // for TimerManager
 
 namespace cszb_scoreboard {
 
@@ -48,7 +50,9 @@ SingletonImpl::~SingletonImpl() {
   delete inst_frame_manager;
   delete inst_hotkey_table;
   delete inst_image_library;
+  delete inst_image_loader;
   delete inst_persistence;
+  delete inst_scaled_image_cache;
   delete inst_slide_show;
   delete inst_team_colors;
   delete inst_team_config;
@@ -127,6 +131,13 @@ auto SingletonImpl::imageLibrary() -> ImageLibrary* {
   return inst_image_library;
 }
 
+auto SingletonImpl::imageLoader() -> ImageLoader* {
+  if (inst_image_loader == nullptr) {
+    inst_image_loader = new ImageLoader(SingletonClass{});
+  }
+  return inst_image_loader;
+}
+
 auto SingletonImpl::persistence() -> Persistence* {
   if (inst_persistence == nullptr) {
     inst_persistence = new Persistence(SingletonClass{});
@@ -134,6 +145,13 @@ auto SingletonImpl::persistence() -> Persistence* {
   return inst_persistence;
 }
 
+auto SingletonImpl::scaledImageCache() -> ScaledImageCache* {
+  if (inst_scaled_image_cache == nullptr) {
+    inst_scaled_image_cache = new ScaledImageCache(SingletonClass{});
+  }
+  return inst_scaled_image_cache;
+}
+
 auto SingletonImpl::slideShow() -> SlideShow* {
   if (inst_slide_show == nullptr) {
     inst_slide_show = new SlideShow(SingletonClass{});
@@ -22,10 +22,14 @@ limitations under the License.
 #include <compare>  // for operator<, strong_ordering
 #include <ratio>    // for ratio
 
-#include "util/StringUtil.h"  // for StringUtil
+#include "ui/event/AutoRefreshTimer.h"  // for AutoRefreshTimer
+#include "util/AnimationClock.h"        // for AnimationClock
+#include "util/StringUtil.h"            // for StringUtil
 
 namespace cszb_scoreboard {
 
+constexpr int64_t MILLIS_PER_SECOND = 1000;
+
 TimerManager::TimerManager(SingletonClass c, Singleton* singleton) {
   timer_displayed = false;
   timer_running = false;
@@ -42,6 +46,8 @@ void TimerManager::setTime(int64_t seconds) {
                   std::chrono::system_clock::now().time_since_epoch()) +
               new_time_left;
   time_left = new_time_left;
+  // A paused timer won't repaint on its own, so show the new time now.
+  requestRefresh();
 }
 
 void TimerManager::startTimer() {
@@ -50,26 +56,31 @@ void TimerManager::startTimer() {
     timer_end = std::chrono::duration_cast<std::chrono::seconds>(
                     std::chrono::system_clock::now().time_since_epoch()) +
                 time_left;
+    wakeRefreshTimer();
   }
 }
 
-void TimerManager::pauseTimer() { timer_running = false; }
+void TimerManager::pauseTimer() {
+  if (timer_running) {
+    timer_running = false;
+    requestRefresh();
+  }
+}
 
 void TimerManager::showTimer() {
   if (!timer_displayed) {
     timer_displayed = true;
-    singleton->autoRefreshTimer();
+    // Paint the timer straight away, even if it's paused, and keep painting it
+    // while it runs.
+    requestRefresh();
   }
 }
 
 void TimerManager::hideTimer() {
   if (timer_displayed) {
     timer_displayed = false;
-    // We used to stop the autorefresh timer when this was the only client.  Now
-    // we either just let it run indefinitely or we should have a use counter
-    // going.
-    // refresh_timer->stop();
-    // refresh_timer.reset();
+    // The refresh timer goes idle on its own once nothing is animated, so there
+    // is nothing to stop here.
   }
 }
 
@@ -84,6 +95,37 @@ auto TimerManager::displayTime() -> std::string {
          StringUtil::intToString(seconds_left.count(), 2);
 }
 
+auto TimerManager::nextDisplayChange(int64_t after_millis) const
+    -> std::optional<int64_t> {
+  if (!timer_running) {
+    return std::nullopt;
+  }
+  // The time left is counted in whole seconds of the system clock, so it ticks
+  // over on each second boundary until it reaches zero at timer_end.
+  int64_t next_second =
+      AnimationClock::toSystemMillis(after_millis) / MILLIS_PER_SECOND + 1;
+  if (next_second > timer_end.count()) {
+    return std::nullopt;
+  }
+  return AnimationClock::fromSystemMillis(next_second * MILLIS_PER_SECOND);
+}
+
+void TimerManager::wakeRefreshTimer() {
+  AutoRefreshTimer* refresh_timer = singleton->autoRefreshTimer();
+  // May be null when the singleton is mocked.
+  if (refresh_timer != nullptr) {
+    refresh_timer->wake();
+  }
+}
+
+void TimerManager::requestRefresh() {
+  AutoRefreshTimer* refresh_timer = singleton->autoRefreshTimer();
+  // May be null when the singleton is mocked.
+  if (refresh_timer != nullptr) {
+    refresh_timer->requestRefresh();
+  }
+}
+
 auto TimerManager::timeLeft() -> std::chrono::seconds {
   if (timer_running) {
     time_left =
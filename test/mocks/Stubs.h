@@ -55,6 +55,10 @@ auto FrameManager::createScreenPresenter(int monitor_number,
 
 void FrameManager::refreshFrames() {}
 
+auto FrameManager::refreshAnimations(int64_t now) -> std::optional<int64_t> {
+  return std::nullopt;
+}
+
 void FrameManager::exitFrames() {}
 
 auto FrameManager::monitor(uint32_t index) -> Display { return Display(0); }
@@ -73,12 +77,25 @@ void cszb_scoreboard::MainView::init(){};
 #ifdef TEST_STUB_PERSISTENT_TIMER
 
 std::function<void()> last_on_tick;
+// The period most recently passed to start, for tests of timers which schedule
+// themselves.
+int last_start_period = 0;
 
 PersistentTimer::PersistentTimer(int period,
                                  std::function<void()> const& on_tick) {
   last_on_tick = on_tick;
 }
 
+PersistentTimer::PersistentTimer(std::function<void()> const& on_tick) {
+  last_on_tick = on_tick;
+}
+
+void PersistentTimer::start(int period, bool one_shot) {
+  last_start_period = period;
+}
+
+void PersistentTimer::stop() {}
+
 // This is a bit of a hack to simulate timers executing on their schedule for
 // unit testing.  This method is not presently even implemented in the
 // production version of this class.
@@ -41,6 +41,8 @@ class MockFrameManager : public FrameManager {
               (int monitor_number, const ScreenText& preview), (override));
   MOCK_METHOD(MainView*, mainView, (), (override));
   MOCK_METHOD(void, refreshFrames, (), (override));
+  MOCK_METHOD(std::optional<int64_t>, refreshAnimations, (int64_t now),
+              (override));
   MOCK_METHOD(void, exitFrames, (), (override));
   MOCK_METHOD(int32_t, monitorCount, (), (override));
   MOCK_METHOD(Display, monitor, (uint32_t index), (override));
@@ -41,7 +41,9 @@ class MockSingleton : public Singleton {
   MOCK_METHOD(GeneralConfig*, generalConfig, (), (override));
   MOCK_METHOD(HotkeyTable*, hotkeyTable, (), (override));
   MOCK_METHOD(ImageLibrary*, imageLibrary, (), (override));
+  MOCK_METHOD(ImageLoader*, imageLoader, (), (override));
   MOCK_METHOD(Persistence*, persistence, (), (override));
+  MOCK_METHOD(ScaledImageCache*, scaledImageCache, (), (override));
   MOCK_METHOD(SlideShow*, slideShow, (), (override));
   MOCK_METHOD(TeamColors*, teamColors, (), (override));
   MOCK_METHOD(TeamConfig*, teamConfig, (), (override));
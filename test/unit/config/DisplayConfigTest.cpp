@@ -20,12 +20,14 @@ limitations under the License.
 #include <gtest/gtest.h>                               // for TestInfo (ptr ...
 #include <wx/gdicmn.h>                                 // for wxRect, wxPoint
 
-#include <cstdint>  // for int32_t
-#include <memory>   // for unique_ptr
-#include <string>   // for string
+#include <cstdint>   // for int32_t
+#include <memory>    // for unique_ptr
+#include <optional>  // for optional
+#include <string>    // for string
 
 #include "config.pb.h"                             // for DisplayConfig
 #include "config/DisplayConfig.h"                  // for DisplayConfig
+#include "config/Position.h"                       // for Size
 #include "test/TestUtil.h"                         // for EXPECT_ASSERT
 #include "test/mocks/config/MockPersistence.h"     // for MockPersistence
 #include "test/mocks/ui/frame/MockFrameManager.h"  // for MockFrameManager
@@ -289,6 +291,24 @@ TEST_F(DisplayConfigTest, TripleExternalMonitorSetup) {
   EXPECT_PROTO_EQ(expected, config.displayConfig());
 }
 
+TEST_F(DisplayConfigTest, LargestDisplaySize) {
+  // Load display to flush the call expected in SetUp.
+  persist->loadDisplays();
+  display_config.reset();
+  display_config = std::make_unique<proto::DisplayConfig>();
+  persist->saveDisplays(*display_config);
+  EXPECT_CALL(*frame_manager, monitorCount).WillOnce(Return(3));
+  EXPECT_CALL(*frame_manager, monitor(0)).WillRepeatedly(Return(monitor1()));
+  EXPECT_CALL(*frame_manager, monitor(1)).WillRepeatedly(Return(monitor2()));
+  EXPECT_CALL(*frame_manager, monitor(2)).WillRepeatedly(Return(monitor3()));
+  DisplayConfig config(SingletonClass{}, singleton.get());
+
+  std::optional<Size> largest = config.largestDisplaySize();
+  ASSERT_TRUE(largest.has_value());
+  EXPECT_EQ(largest->width, 1024);
+  EXPECT_EQ(largest->height, 768);
+}
+
 TEST_F(DisplayConfigTest, SetSide) {
   DisplayConfig config(SingletonClass{}, singleton.get());
   auto* new_side = new proto::ScreenSide();
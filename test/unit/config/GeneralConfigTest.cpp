@@ -70,6 +70,7 @@ class GeneralConfigTest : public ::testing::Test {
 TEST_F(GeneralConfigTest, Defaults) {
   GeneralConfig config(SingletonClass{}, singleton.get());
   EXPECT_EQ(-1, config.dropShadowDistance());
+  EXPECT_EQ(256, config.imageCacheMegabytes());
 }
 
 TEST_F(GeneralConfigTest, LoadSaveSettings) {
@@ -92,6 +93,15 @@ TEST_F(GeneralConfigTest, SetGetDropShadowDistance) {
   EXPECT_EQ(distance, generalConfig.dropShadowDistance());
 }
 
+TEST_F(GeneralConfigTest, SetGetImageCacheMegabytes) {
+  GeneralConfig generalConfig(SingletonClass{}, singleton.get());
+
+  generalConfig.setImageCacheMegabytes(64);
+  EXPECT_EQ(64, generalConfig.imageCacheMegabytes());
+  generalConfig.saveSettings();
+  EXPECT_EQ(64, persist->loadGeneralConfig().image_cache_megabytes());
+}
+
 TEST_F(GeneralConfigTest, SaveSettings) {
   const double shadowDistance = 1.0;
   GeneralConfig initialConfig(SingletonClass{}, singleton.get());
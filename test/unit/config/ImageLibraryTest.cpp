@@ -278,6 +278,70 @@ TEST_F(ImageLibraryTest, CaseInsensitiveSearches) {
               ElementsAre(FilesystemPath(libRoot("but-why.jpg"))));
 }
 
+// Partial searches list images with a tag starting with the query first.
+TEST_F(ImageLibraryTest, PartialSearchesRankPrefixes) {
+  library->addImage(FilesystemPath(libRoot("braces.jpg")), "orthodontist",
+                    {});
+  auto result = library->search("ort");
+  EXPECT_THAT(result.matchedTags(), ElementsAre("orthodontist", "short"));
+  EXPECT_THAT(result.filenames(),
+              ElementsAre(libRoot("braces.jpg"), libRoot("corgi.jpg"),
+                          nonlibRoot("capy.jpg")));
+
+  // Longer queries are checked in full, not just in pieces.
+  EXPECT_TRUE(library->search("shortho").filenames().empty());
+}
+
+// Searches reflect changes made to the library after it was loaded.
+TEST_F(ImageLibraryTest, SearchesFollowChanges) {
+  library->setTags(FilesystemPath(libRoot("corgi.jpg")), {"floof"});
+  EXPECT_THAT(library->search("dog").filenames(),
+              ElementsAre(libRoot("great_dane.jpg")));
+  EXPECT_THAT(tagStrings(*library),
+              ElementsAre("cute", "dog", "floof", "gender", "neutral",
+                          "rodent", "short", "Stall", "tall"));
+
+  library->deleteImage(FilesystemPath("great_dane.jpg"));
+  EXPECT_TRUE(library->search("dog").filenames().empty());
+  EXPECT_THAT(library->search("cute").filenames(),
+              ElementsAre(nonlibRoot("capy.jpg")));
+  EXPECT_THAT(library->search("all").filenames(),
+              ElementsAre(libRoot("but-why.jpg")));
+
+  library->addImage(FilesystemPath(libRoot("pug.jpg")), "pug", {"dog"});
+  library->setName(FilesystemPath(libRoot("corgi.jpg")), "dogsbody");
+  auto result = library->search("dog");
+  EXPECT_THAT(result.matchedTags(), ElementsAre("dog"));
+  EXPECT_THAT(result.filenames(), ElementsAre(libRoot("pug.jpg")));
+  result = library->search("do");
+  EXPECT_THAT(result.matchedTags(), ElementsAre("dog", "dogsbody"));
+  EXPECT_THAT(result.filenames(),
+              ElementsAre(libRoot("corgi.jpg"), libRoot("pug.jpg")));
+}
+
+// Repeated searches are answered from a cache, which every change to the
+// library invalidates.
+TEST_F(ImageLibraryTest, RepeatedSearches) {
+  EXPECT_THAT(library->search("cute").filenames(),
+              ElementsAre(libRoot("corgi.jpg"), libRoot("great_dane.jpg"),
+                          nonlibRoot("capy.jpg")));
+  EXPECT_THAT(library->search("cute").filenames(),
+              ElementsAre(libRoot("corgi.jpg"), libRoot("great_dane.jpg"),
+                          nonlibRoot("capy.jpg")));
+
+  library->moveLibraryRoot(FilesystemPath(nonlibRoot()));
+  EXPECT_THAT(library->search("cute").filenames(),
+              ElementsAre(libRoot("corgi.jpg"), nonlibRoot("great_dane.jpg"),
+                          nonlibRoot("capy.jpg")));
+
+  library->setTags(FilesystemPath("great_dane.jpg"), {"tall"});
+  EXPECT_THAT(library->search("cute").filenames(),
+              ElementsAre(libRoot("corgi.jpg"), nonlibRoot("capy.jpg")));
+
+  library->clearLibrary();
+  EXPECT_TRUE(library->search("cute").filenames().empty());
+}
+
 TEST_F(ImageLibraryTest, RemoveRoot) {
   library->removeLibraryRoot();
   std::vector<FilesystemPath> files = library->allFilenames();
@@ -373,6 +437,46 @@ TEST_F(ImageLibraryTest, DeleteImage) {
                           libRoot("but-why.jpg")));
 }
 
+TEST_F(ImageLibraryTest, DeleteImages) {
+  library->deleteImages({FilesystemPath(libRoot("corgi.jpg")),
+                         FilesystemPath("capy.jpg"),
+                         FilesystemPath(libRoot("but-why.jpg"))});
+  // Only exact matches are deleted.
+  EXPECT_THAT(library->allFilenames(),
+              ElementsAre("great_dane.jpg", nonlibRoot("capy.jpg")));
+  // Tags used only by deleted images are gone, and the rest still find the
+  // images which remain.
+  EXPECT_THAT(tagStrings(*library),
+              ElementsAre("cute", "dog", "rodent", "short", "tall"));
+  EXPECT_THAT(library->search("short").filenames(),
+              ElementsAre(nonlibRoot("capy.jpg")));
+  EXPECT_THAT(library->search("sta").filenames(), ElementsAre());
+  EXPECT_EQ("capybara", library->name(FilesystemPath(nonlibRoot("capy.jpg"))));
+}
+
+// Images are found by path however their separators are written, and stay
+// findable as other images around them change.
+TEST_F(ImageLibraryTest, PathLookups) {
+  EXPECT_EQ("corgi", library->name(FilesystemPath(libRoot() + "//corgi.jpg")));
+
+  library->deleteImage(FilesystemPath(libRoot("corgi.jpg")));
+  library->moveImage(FilesystemPath(nonlibRoot("capy.jpg")),
+                     FilesystemPath(libRoot("capybara.jpg")));
+  library->setTags(FilesystemPath("capybara.jpg"), {"swimmer"});
+  EXPECT_EQ("capybara", library->name(FilesystemPath("capybara.jpg")));
+  EXPECT_THAT(library->tags(FilesystemPath("capybara.jpg")),
+              ElementsAre(CaseOptionalString("swimmer")));
+  EXPECT_EQ("great dane", library->name(FilesystemPath("great_dane.jpg")));
+  EXPECT_EQ("Bathroom", library->name(FilesystemPath(libRoot("but-why.jpg"))));
+  EXPECT_EQ("", library->name(FilesystemPath(nonlibRoot("capy.jpg"))));
+
+  // Relative paths become absolute when the root moves away from them.
+  library->setLibraryRoot(FilesystemPath(nonlibRoot()));
+  EXPECT_EQ("great dane",
+            library->name(FilesystemPath(libRoot("great_dane.jpg"))));
+  EXPECT_EQ("", library->name(FilesystemPath("great_dane.jpg")));
+}
+
 TEST_F(ImageLibraryTest, TemporaryClone) {
   auto temp = library->temporaryClone();
   ASSERT_NE(library.get(), temp.get());
@@ -539,6 +643,25 @@ TEST_F(ImageLibraryTest, LoadSaveLibrary) {
                                  "new-image.png"));
 }
 
+// Tags are kept apart from their images while loaded, but are saved and cloned
+// along with them.
+TEST_F(ImageLibraryTest, ImagesKeepTheirTags) {
+  library->setTags(FilesystemPath(libRoot("corgi.jpg")),
+                   {"dog", "floof", "dog"});
+  library->saveLibrary();
+
+  proto::ImageLibrary saved = persist->loadImageLibrary();
+  ASSERT_EQ(saved.images_size(), 4);
+  EXPECT_THAT(saved.images(0).tags(), ElementsAre("dog", "floof", "dog"));
+  EXPECT_THAT(saved.images(3).tags(),
+              ElementsAre("gender", "neutral", "Stall"));
+
+  auto clone = library->temporaryClone();
+  EXPECT_THAT(clone->tags(FilesystemPath("great_dane.jpg")),
+              ElementsAre(CaseOptionalString("cute"), CaseOptionalString("dog"),
+                          CaseOptionalString("tall")));
+}
+
 TEST_F(ImageLibraryTest, DetectChangesNoChanges) {
   buildFilesystem();
   LibraryUpdateResults results =
@@ -19,19 +19,27 @@ limitations under the License.
 #include <gtest/gtest.h>  // for EXPECT_EQ, TestInfo (...
 #include <wx/log.h>       // for wxLogNull
 
-#include <chrono>  // IWYU pragma: keep for seconds
-#include <memory>  // for allocator, unique_ptr
-#include <thread>  // for sleep_for
-#include <vector>  // for vector
-
+#include <cstdint>     // for int64_t
+#include <filesystem>  // for path
+#include <fstream>     // for ofstream
+#include <memory>      // for allocator, unique_ptr
+#include <optional>    // for optional, nullopt
+#include <string>      // for string
+#include <vector>      // for vector
+
+#include "config/Position.h"                    // for Size
 #include "config/SlideShow.h"                   // for SlideShow
 #include "slide_show.pb.h"                      // for SlideInfo, SlideShow
 #include "test/mocks/config/MockPersistence.h"  // for MockPersistence
 #include "test/mocks/util/MockSingleton.h"      // for MockSingleton
+#include "test/util/TaskQueue.h"                // for TaskQueue
+#include "test/util/TempFilesystem.h"           // for TempFilesystem
+#include "ui/graphics/ImageLoader.h"            // for ImageLoader
 #include "ui/widget/Image.h"                    // for Image
+#include "util/AnimationClock.h"                // for AnimationClock
+#include "util/Base64.h"                        // for Base64
 #include "util/FilesystemPath.h"                // for FilesystemPath
 #include "util/Singleton.h"                     // for SingletonClass, Singl...
-// IWYU pragma: no_include <bits/chrono.h>
 
 #define TEST_STUB_SINGLETON
 #include "test/mocks/Stubs.h"  // for Singleton::getInstance
@@ -45,10 +53,20 @@ namespace cszb_scoreboard::test {
 
 using ::testing::Return;
 
+const Size SLIDE_SIZE{.width = 4, .height = 2};
+
+// A 2-frame 1x1 animated GIF.
+const std::string GIF_BASE64 =
+    "R0lGODlhAQABAIAAAAAAAP///yH/"
+    "C05FVFNDQVBFMi4wAwEAAAAh+"
+    "QQACgAAACwAAAAAAQABAAACAkQBACH5BAAKAAAALAAAAAABAAEAAAICTAEAOw==";
+
 class SlideShowTest : public ::testing::Test {
  protected:
   MockSingleton* mock_singleton;
   std::unique_ptr<MockPersistence> mock_persistence;
+  TaskQueue tasks;
+  std::unique_ptr<ImageLoader> image_loader;
   std::unique_ptr<wxLogNull> log_no;
 
   void SetUp() override {
@@ -57,10 +75,15 @@ class SlideShowTest : public ::testing::Test {
     mock_persistence = std::make_unique<MockPersistence>(mock_singleton);
     EXPECT_CALL(*mock_singleton, persistence())
         .WillRepeatedly(Return(mock_persistence.get()));
+    image_loader = std::make_unique<ImageLoader>(SingletonClass{}, 1,
+                                                 tasks.dispatcher());
+    EXPECT_CALL(*mock_singleton, imageLoader())
+        .WillRepeatedly(Return(image_loader.get()));
   }
 
   void TearDown() override {
     mock_persistence.reset();
+    image_loader.reset();
     log_no.reset();
   }
 };
@@ -133,32 +156,115 @@ TEST_F(SlideShowTest, SlideOperations) {
 
 TEST_F(SlideShowTest, TimingAndTransitions) {
   proto::SlideShow initial_show;
-  initial_show.set_delay(0.001);  // minimal delay for fast testing
-  auto* slide1 = initial_show.add_slides();
-  slide1->set_name("SlideA");
-  slide1->set_file_path("");
-
-  auto* slide2 = initial_show.add_slides();
-  slide2->set_name("SlideB");
-  slide2->set_file_path("");
-
+  initial_show.set_delay(0.25);
+  for (const std::string name : {"SlideA", "SlideB", "SlideC"}) {
+    auto* slide = initial_show.add_slides();
+    slide->set_name(name);
+    slide->set_file_path("");
+  }
   mock_persistence->saveSlideShow(initial_show);
 
   SlideShow show(SingletonClass{}, mock_singleton);
+  EXPECT_EQ(show.nextTransition(AnimationClock::now()), std::nullopt);
   show.start();
   EXPECT_TRUE(show.isRunning());
 
-  // First call to nextSlide
-  Image img1 = show.nextSlide();
+  std::optional<int64_t> transition =
+      show.nextTransition(AnimationClock::now());
+  ASSERT_TRUE(transition.has_value());
+  int64_t first = *transition;
+
+  // Nothing happens before the deadline.
+  show.advance(first - 1);
+  EXPECT_EQ(show.slideNumber(), 0);
+  EXPECT_EQ(show.nextTransition(first - 1), first);
+
+  // A transition which has just happened is still reported to anything which
+  // last looked before it, so that it knows to repaint.
+  show.advance(first);
+  EXPECT_EQ(show.slideNumber(), 1);
+  EXPECT_EQ(show.nextTransition(first - 1), first);
+  EXPECT_EQ(show.nextTransition(first), first + 250);
+
+  // Falling behind skips ahead to the slide which should be showing, and the
+  // deadlines stay on the original schedule.
+  show.advance(first + 510);
+  EXPECT_EQ(show.slideNumber(), 0);
+  EXPECT_EQ(show.nextTransition(first + 510), first + 750);
+
+  // Stopping asks for a repaint, to take the show down.
+  EXPECT_CALL(*mock_singleton, autoRefreshTimer()).WillOnce(Return(nullptr));
+  show.stop();
+  EXPECT_FALSE(show.isRunning());
+  EXPECT_EQ(show.nextTransition(first + 510), std::nullopt);
+  ::testing::Mock::VerifyAndClearExpectations(mock_singleton);
+}
+
+TEST_F(SlideShowTest, DelayChangesApplyToRunningShow) {
+  proto::SlideShow initial_show;
+  initial_show.set_delay(60);
+  for (const std::string name : {"SlideA", "SlideB"}) {
+    auto* slide = initial_show.add_slides();
+    slide->set_name(name);
+    slide->set_file_path("");
+  }
+  mock_persistence->saveSlideShow(initial_show);
 
-  // Sleep slightly to ensure transition triggers
-  std::this_thread::sleep_for(std::chrono::milliseconds(5));
+  SlideShow show(SingletonClass{}, mock_singleton);
+  // Not running, so there's nothing to reschedule.
+  EXPECT_CALL(*mock_singleton, autoRefreshTimer()).Times(0);
+  show.setDelay(30);
+  ::testing::Mock::VerifyAndClearExpectations(mock_singleton);
 
-  // Second call should transition to the next slide
-  Image img2 = show.nextSlide();
+  show.start();
+  int64_t first = *show.nextTransition(AnimationClock::now());
+  int64_t started = first - 30000;
+
+  // Shortening the delay brings the next transition forward, and wakes the
+  // refresh timer in case it's waiting on the old one.
+  EXPECT_CALL(*mock_singleton, autoRefreshTimer()).WillOnce(Return(nullptr));
+  show.setDelay(2);
+  ::testing::Mock::VerifyAndClearExpectations(mock_singleton);
+  EXPECT_EQ(show.nextTransition(started), started + 2000);
+  show.advance(started + 2000);
+  EXPECT_EQ(show.slideNumber(), 1);
+  EXPECT_EQ(show.nextTransition(started + 2000), started + 4000);
 
   show.stop();
-  EXPECT_FALSE(show.isRunning());
+}
+
+TEST_F(SlideShowTest, UnusedSizesAreDropped) {
+  proto::SlideShow initial_show;
+  initial_show.set_delay(0.25);
+  for (const std::string name : {"SlideA", "SlideB"}) {
+    auto* slide = initial_show.add_slides();
+    slide->set_name(name);
+    slide->set_file_path("");
+  }
+  mock_persistence->saveSlideShow(initial_show);
+
+  SlideShow show(SingletonClass{}, mock_singleton);
+  show.start();
+  int64_t first = *show.nextTransition(AnimationClock::now());
+  const Size other_size{.width = 8, .height = 4};
+  show.currentSlide(SLIDE_SIZE);
+  show.currentSlide(other_size);
+  EXPECT_EQ(show.preparedSizes(), 2);
+
+  // Both sizes were asked for before this transition, so both are kept.
+  show.advance(first);
+  EXPECT_EQ(show.preparedSizes(), 2);
+
+  // Only one is asked for before the next, so the other is dropped.
+  show.currentSlide(SLIDE_SIZE);
+  show.advance(first + 250);
+  EXPECT_EQ(show.preparedSizes(), 1);
+  show.currentSlide(other_size);
+  EXPECT_EQ(show.preparedSizes(), 2);
+
+  EXPECT_CALL(*mock_singleton, autoRefreshTimer()).WillOnce(Return(nullptr));
+  show.stop();
+  ::testing::Mock::VerifyAndClearExpectations(mock_singleton);
 }
 
 TEST_F(SlideShowTest, EmptyShowGracefulExit) {
@@ -169,8 +275,46 @@ TEST_F(SlideShowTest, EmptyShowGracefulExit) {
   show.start();
   EXPECT_TRUE(show.isRunning());
 
-  Image img = show.nextSlide();
+  Image img = show.currentSlide(SLIDE_SIZE);
   EXPECT_FALSE(show.isRunning());  // Stops running automatically if empty
 }
 
+TEST_F(SlideShowTest, SlidesArePreparedAhead) {
+  TempFilesystem filesystem;
+  std::vector<char> gif;
+  Base64::decode(GIF_BASE64, &gif);
+  proto::SlideShow initial_show;
+  initial_show.set_delay(60);
+  for (const std::string name : {"a.gif", "b.gif", "c.gif", "d.gif"}) {
+    std::filesystem::path path = filesystem.getRoot() / name;
+    std::ofstream file(path, std::ios::binary);
+    file.write(gif.data(), static_cast<std::streamsize>(gif.size()));
+    auto* slide = initial_show.add_slides();
+    slide->set_name(name);
+    slide->set_file_path(path.string());
+  }
+  mock_persistence->saveSlideShow(initial_show);
+
+  SlideShow show(SingletonClass{}, mock_singleton);
+  show.start();
+
+  // Nothing is shown until the first slide has loaded.
+  EXPECT_FALSE(show.currentSlide(SLIDE_SIZE).isOk());
+
+  // The current slide and the two after it are loaded, in order.
+  tasks.next()();
+  Image first = show.currentSlide(SLIDE_SIZE);
+  ASSERT_TRUE(first.isOk());
+  // Scaled to fit while loading.
+  EXPECT_EQ(first.size().width, 2);
+  EXPECT_EQ(first.size().height, 2);
+  tasks.next()();
+  tasks.next()();
+
+  // Calling again returns the same prepared image, rather than loading it
+  // again.
+  EXPECT_EQ(show.currentSlide(SLIDE_SIZE).wx().GetData(), first.wx().GetData());
+  show.stop();
+}
+
 }  // namespace cszb_scoreboard::test
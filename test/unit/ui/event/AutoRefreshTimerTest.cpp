@@ -0,0 +1,128 @@
+/*
+test/unit/ui/event/AutoRefreshTimerTest.cpp: Tests for
+ui/event/AutoRefreshTimer
+
+Copyright 2026 Tracy Beck
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+*/
+
+#include <gtest/gtest.h>  // for TestInfo (ptr only)
+
+#include <cstdint>   // for int64_t
+#include <memory>    // for unique_ptr, make_unique
+#include <optional>  // for optional
+
+#include "config/SlideShow.h"                      // for SlideShow
+#include "test/mocks/config/MockPersistence.h"     // for MockPersistence
+#include "test/mocks/ui/frame/MockFrameManager.h"  // for MockFrameManager
+#include "test/mocks/util/MockSingleton.h"         // for MockSingleton
+#include "ui/event/AutoRefreshTimer.h"             // for AutoRefreshTimer
+#include "util/Singleton.h"                        // for SingletonClass
+
+#define TEST_STUB_PERSISTENT_TIMER
+#define TEST_STUB_SINGLETON
+#include "test/mocks/Stubs.h"  // for PersistentTimer::trigger
+
+// IWYU pragma: no_include "gmock/gmock.h"
+// IWYU pragma: no_include "gtest/gtest.h"
+// IWYU pragma: no_include <gtest/gtest_pred_impl.h>
+// IWYU pragma: no_include "gtest/gtest_pred_impl.h"
+
+using ::testing::_;
+using ::testing::Return;
+
+namespace cszb_scoreboard::test {
+
+// How long the next animation change is held off for in these tests.
+constexpr int64_t DISTANT_CHANGE_MILLIS = 10000;
+
+class AutoRefreshTimerTest : public ::testing::Test {
+ protected:
+  MockSingleton* singleton;
+  std::unique_ptr<MockPersistence> persistence;
+  std::unique_ptr<SlideShow> slide_show;
+  std::unique_ptr<MockFrameManager> frame_manager;
+
+  void SetUp() override {
+    singleton = static_cast<MockSingleton*>(Singleton::getInstance());
+    persistence = std::make_unique<MockPersistence>(singleton);
+    EXPECT_CALL(*singleton, persistence())
+        .WillRepeatedly(Return(persistence.get()));
+    slide_show = std::make_unique<SlideShow>(SingletonClass{}, singleton);
+    EXPECT_CALL(*singleton, slideShow())
+        .WillRepeatedly(Return(slide_show.get()));
+    frame_manager = std::make_unique<MockFrameManager>();
+    EXPECT_CALL(*singleton, frameManager())
+        .WillRepeatedly(Return(frame_manager.get()));
+    last_start_period = 0;
+  }
+
+  void TearDown() override {
+    slide_show.reset();
+    frame_manager.reset();
+    persistence.reset();
+    ::testing::Mock::VerifyAndClearExpectations(singleton);
+  }
+
+  // Ticks the timer, with the next animation change a long way off.
+  void tickWithDistantChange(AutoRefreshTimer* timer) {
+    EXPECT_CALL(*frame_manager, refreshAnimations(_))
+        .WillOnce([](int64_t now) -> std::optional<int64_t> {
+          return now + DISTANT_CHANGE_MILLIS;
+        });
+    timer->trigger();
+  }
+};
+
+TEST_F(AutoRefreshTimerTest, WakeStartsAnIdleTimer) {
+  AutoRefreshTimer timer(singleton);
+  timer.wake();
+  EXPECT_EQ(last_start_period, 1);
+}
+
+TEST_F(AutoRefreshTimerTest, WakeCutsShortADistantTick) {
+  AutoRefreshTimer timer(singleton);
+  tickWithDistantChange(&timer);
+  EXPECT_GT(last_start_period, 1);
+  EXPECT_LE(last_start_period, DISTANT_CHANGE_MILLIS);
+
+  // Something which changes sooner (such as a newly started timer) mustn't
+  // wait for the distant tick.
+  timer.wake();
+  EXPECT_EQ(last_start_period, 1);
+}
+
+TEST_F(AutoRefreshTimerTest, WakeKeepsASoonerTick) {
+  AutoRefreshTimer timer(singleton);
+  timer.wake();
+  last_start_period = 0;
+
+  // The tick which is already due is soon enough.
+  timer.wake();
+  EXPECT_EQ(last_start_period, 0);
+}
+
+TEST_F(AutoRefreshTimerTest, RequestRefreshRefreshesFramesOnce) {
+  AutoRefreshTimer timer(singleton);
+  tickWithDistantChange(&timer);
+  timer.requestRefresh();
+  EXPECT_EQ(last_start_period, 1);
+
+  EXPECT_CALL(*frame_manager, refreshFrames()).Times(1);
+  tickWithDistantChange(&timer);
+  EXPECT_CALL(*frame_manager, refreshFrames()).Times(0);
+  tickWithDistantChange(&timer);
+}
+
+}  // namespace cszb_scoreboard::test
@@ -0,0 +1,335 @@
+/*
+test/unit/ui/graphics/GifDecoderTest.cpp: Tests for ui/graphics/GifDecoder
+
+Copyright 2026 Tracy Beck
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+*/
+
+#include <gtest/gtest.h>
+
+#include <cstdint>  // for uint8_t, uint32_t
+#include <map>      // for map
+#include <string>   // for string
+#include <utility>  // for pair
+#include <vector>   // for vector
+
+#include "ui/graphics/GifDecoder.h"  // for GifDecoder
+#include "util/Base64.h"             // for Base64
+
+// IWYU pragma: no_include "gmock/gmock.h"
+// IWYU pragma: no_include "gtest/gtest.h"
+// IWYU pragma: no_include <gtest/gtest_pred_impl.h>
+// IWYU pragma: no_include "gtest/gtest_pred_impl.h"
+
+namespace cszb_scoreboard::test {
+
+// A 2-frame 1x1 animated GIF, as produced by a typical encoder.
+const std::string ANIMATED_GIF_BASE64 =
+    "R0lGODlhAQABAIAAAAAAAP///yH/"
+    "C05FVFNDQVBFMi4wAwEAAAAh+"
+    "QQACgAAACwAAAAAAQABAAACAkQBACH5BAAKAAAALAAAAAABAAEAAAICTAEAOw==";
+
+// Palette entries for the test GIFs: black, red, green and blue.
+const std::vector<uint8_t> PALETTE = {0, 0, 0, 255, 0, 0, 0, 255, 0, 0, 0, 255};
+constexpr uint8_t RED = 1;
+constexpr uint8_t GREEN = 2;
+constexpr uint8_t BLUE = 3;
+constexpr uint8_t TRANSPARENT = 0;
+
+struct TestFrame {
+  int x;
+  int y;
+  int width;
+  int height;
+  std::vector<uint8_t> pixels;
+  int disposal = 1;
+  int delay = 5;
+  bool interlaced = false;
+};
+
+class BitWriter {
+ public:
+  void write(int code, int size) {
+    bits |= static_cast<uint32_t>(code) << count;
+    count += size;
+    while (count >= 8) {
+      bytes.push_back(static_cast<uint8_t>(bits & 0xFF));
+      bits >>= 8;
+      count -= 8;
+    }
+  }
+  auto finish() -> std::vector<uint8_t> {
+    if (count > 0) {
+      bytes.push_back(static_cast<uint8_t>(bits & 0xFF));
+    }
+    return bytes;
+  }
+
+ private:
+  std::vector<uint8_t> bytes;
+  uint32_t bits = 0;
+  int count = 0;
+};
+
+// A straightforward LZW encoder, so that tests can build GIFs of any size.
+auto lzwEncode(const std::vector<uint8_t>& pixels, int min_code_size)
+    -> std::vector<uint8_t> {
+  const int clear_code = 1 << min_code_size;
+  const int end_code = clear_code + 1;
+  int code_size = min_code_size + 1;
+  int next_code = end_code + 1;
+  std::map<std::pair<int, uint8_t>, int> table;
+  BitWriter writer;
+  writer.write(clear_code, code_size);
+  int prefix = -1;
+  for (uint8_t pixel : pixels) {
+    if (prefix < 0) {
+      prefix = pixel;
+      continue;
+    }
+    auto entry = table.find({prefix, pixel});
+    if (entry != table.end()) {
+      prefix = entry->second;
+      continue;
+    }
+    writer.write(prefix, code_size);
+    table[{prefix, pixel}] = next_code++;
+    if (next_code > (1 << code_size) && code_size < 12) {
+      ++code_size;
+    }
+    if (next_code == 4096) {
+      writer.write(clear_code, code_size);
+      table.clear();
+      code_size = min_code_size + 1;
+      next_code = end_code + 1;
+    }
+    prefix = pixel;
+  }
+  if (prefix >= 0) {
+    writer.write(prefix, code_size);
+    if (++next_code > (1 << code_size) && code_size < 12) {
+      ++code_size;
+    }
+  }
+  writer.write(end_code, code_size);
+  return writer.finish();
+}
+
+void appendWord(std::vector<char>* out, int value) {
+  out->push_back(static_cast<char>(value & 0xFF));
+  out->push_back(static_cast<char>((value >> 8) & 0xFF));
+}
+
+auto buildGif(int width, int height, const std::vector<TestFrame>& frames)
+    -> std::vector<char> {
+  std::string header = "GIF89a";
+  std::vector<char> out(header.begin(), header.end());
+  appendWord(&out, width);
+  appendWord(&out, height);
+  // A global palette of four colors.
+  out.push_back(static_cast<char>(0x81));
+  out.push_back(0);
+  out.push_back(0);
+  for (uint8_t value : PALETTE) {
+    out.push_back(static_cast<char>(value));
+  }
+  for (const auto& frame : frames) {
+    out.push_back(0x21);
+    out.push_back(static_cast<char>(0xF9));
+    out.push_back(4);
+    out.push_back(static_cast<char>((frame.disposal << 2) | 1));
+    appendWord(&out, frame.delay);
+    out.push_back(TRANSPARENT);
+    out.push_back(0);
+
+    out.push_back(0x2C);
+    appendWord(&out, frame.x);
+    appendWord(&out, frame.y);
+    appendWord(&out, frame.width);
+    appendWord(&out, frame.height);
+    out.push_back(static_cast<char>(frame.interlaced ? 0x40 : 0));
+
+    std::vector<uint8_t> stored = frame.pixels;
+    if (frame.interlaced) {
+      stored.clear();
+      for (auto [start, step] : std::vector<std::pair<int, int>>{
+               {0, 8}, {4, 8}, {2, 4}, {1, 2}}) {
+        for (int row = start; row < frame.height; row += step) {
+          stored.insert(stored.end(),
+                        frame.pixels.begin() + row * frame.width,
+                        frame.pixels.begin() + (row + 1) * frame.width);
+        }
+      }
+    }
+    out.push_back(2);
+    std::vector<uint8_t> compressed = lzwEncode(stored, 2);
+    for (size_t i = 0; i < compressed.size(); i += 255) {
+      size_t length = std::min<size_t>(255, compressed.size() - i);
+      out.push_back(static_cast<char>(length));
+      out.insert(out.end(), compressed.begin() + i,
+                 compressed.begin() + i + length);
+    }
+    out.push_back(0);
+  }
+  out.push_back(0x3B);
+  return out;
+}
+
+// The palette index of each canvas pixel, or TRANSPARENT if it has no alpha.
+auto canvasIndices(const GifDecoder& decoder) -> std::vector<uint8_t> {
+  std::vector<uint8_t> indices;
+  for (size_t i = 0; i < decoder.alpha().size(); ++i) {
+    if (decoder.alpha()[i] == 0) {
+      indices.push_back(TRANSPARENT);
+      continue;
+    }
+    for (uint8_t index = 0; index < PALETTE.size() / 3; ++index) {
+      if (decoder.rgb()[i * 3] == PALETTE[index * 3] &&
+          decoder.rgb()[i * 3 + 1] == PALETTE[index * 3 + 1] &&
+          decoder.rgb()[i * 3 + 2] == PALETTE[index * 3 + 2]) {
+        indices.push_back(index);
+        break;
+      }
+    }
+  }
+  return indices;
+}
+
+TEST(GifDecoderTest, ParsesEncoderOutput) {
+  std::vector<char> data;
+  Base64::decode(ANIMATED_GIF_BASE64, &data);
+  GifDecoder decoder(data);
+
+  ASSERT_TRUE(decoder.isOk());
+  EXPECT_EQ(decoder.width(), 1);
+  EXPECT_EQ(decoder.height(), 1);
+  EXPECT_EQ(decoder.frameCount(), 2);
+  EXPECT_EQ(decoder.delay(0), 100);
+  EXPECT_EQ(decoder.delay(1), 100);
+
+  ASSERT_TRUE(decoder.composite(0));
+  EXPECT_EQ(decoder.alpha()[0], 255);
+  ASSERT_TRUE(decoder.composite(1));
+  EXPECT_EQ(decoder.compositedFrame(), 1);
+  EXPECT_FALSE(decoder.composite(2));
+}
+
+TEST(GifDecoderTest, RejectsInvalidData) {
+  EXPECT_FALSE(GifDecoder(std::vector<char>()).isOk());
+  std::string not_a_gif = "\x89PNG\r\n\x1a\n0000000000000";
+  EXPECT_FALSE(
+      GifDecoder(std::vector<char>(not_a_gif.begin(), not_a_gif.end()))
+          .isOk());
+}
+
+TEST(GifDecoderTest, TruncatedDataKeepsEarlierFrames) {
+  std::vector<char> data =
+      buildGif(2, 1, {{0, 0, 2, 1, {RED, GREEN}}, {0, 0, 2, 1, {BLUE, BLUE}}});
+  // Cut the file off partway through the second frame's image data.
+  data.resize(data.size() - 4);
+  GifDecoder decoder(data);
+
+  ASSERT_TRUE(decoder.isOk());
+  EXPECT_EQ(decoder.frameCount(), 1);
+  ASSERT_TRUE(decoder.composite(0));
+  EXPECT_EQ(canvasIndices(decoder), std::vector<uint8_t>({RED, GREEN}));
+}
+
+TEST(GifDecoderTest, DecodesLargeFrames) {
+  // Enough varied pixels to grow the code size to its limit and fill the
+  // table more than once.
+  constexpr int SIZE = 200;
+  std::vector<uint8_t> pixels;
+  for (int i = 0; i < SIZE * SIZE; ++i) {
+    pixels.push_back(static_cast<uint8_t>(1 + (i * i / 7 + i / 13) % 3));
+  }
+  GifDecoder decoder(buildGif(SIZE, SIZE, {{0, 0, SIZE, SIZE, pixels}}));
+
+  ASSERT_TRUE(decoder.composite(0));
+  EXPECT_EQ(canvasIndices(decoder), pixels);
+}
+
+TEST(GifDecoderTest, DecodesInterlacedFrames) {
+  constexpr int HEIGHT = 11;
+  std::vector<uint8_t> pixels;
+  for (int row = 0; row < HEIGHT; ++row) {
+    pixels.push_back(static_cast<uint8_t>(1 + row % 3));
+  }
+  TestFrame frame{0, 0, 1, HEIGHT, pixels};
+  frame.interlaced = true;
+  GifDecoder decoder(buildGif(1, HEIGHT, {frame}));
+
+  ASSERT_TRUE(decoder.composite(0));
+  EXPECT_EQ(canvasIndices(decoder), pixels);
+}
+
+TEST(GifDecoderTest, KeepsPreviousFramesUnderTransparency) {
+  GifDecoder decoder(
+      buildGif(3, 1,
+               {{0, 0, 3, 1, {RED, RED, RED}},
+                {1, 0, 2, 1, {GREEN, TRANSPARENT}},
+                {0, 0, 1, 1, {BLUE}}}));
+
+  ASSERT_TRUE(decoder.composite(2));
+  EXPECT_EQ(canvasIndices(decoder), std::vector<uint8_t>({BLUE, GREEN, RED}));
+}
+
+TEST(GifDecoderTest, DisposesToBackground) {
+  TestFrame cleared{1, 0, 2, 1, {GREEN, GREEN}};
+  cleared.disposal = 2;
+  GifDecoder decoder(buildGif(
+      3, 1, {{0, 0, 3, 1, {RED, RED, RED}}, cleared, {0, 0, 1, 1, {BLUE}}}));
+
+  ASSERT_TRUE(decoder.composite(1));
+  EXPECT_EQ(canvasIndices(decoder), std::vector<uint8_t>({RED, GREEN, GREEN}));
+  ASSERT_TRUE(decoder.composite(2));
+  EXPECT_EQ(canvasIndices(decoder),
+            std::vector<uint8_t>({BLUE, TRANSPARENT, TRANSPARENT}));
+}
+
+TEST(GifDecoderTest, DisposesToPrevious) {
+  TestFrame restored{0, 0, 2, 1, {GREEN, GREEN}};
+  restored.disposal = 3;
+  GifDecoder decoder(buildGif(3, 1,
+                              {{0, 0, 3, 1, {RED, RED, RED}},
+                               restored,
+                               {2, 0, 1, 1, {BLUE}}}));
+
+  ASSERT_TRUE(decoder.composite(1));
+  EXPECT_EQ(canvasIndices(decoder), std::vector<uint8_t>({GREEN, GREEN, RED}));
+  ASSERT_TRUE(decoder.composite(2));
+  EXPECT_EQ(canvasIndices(decoder), std::vector<uint8_t>({RED, RED, BLUE}));
+}
+
+TEST(GifDecoderTest, RewindsToEarlierFrames) {
+  GifDecoder decoder(buildGif(
+      2, 1, {{0, 0, 1, 1, {RED}}, {1, 0, 1, 1, {GREEN}}, {0, 0, 1, 1, {BLUE}}}));
+
+  ASSERT_TRUE(decoder.composite(2));
+  EXPECT_EQ(canvasIndices(decoder), std::vector<uint8_t>({BLUE, GREEN}));
+  ASSERT_TRUE(decoder.composite(0));
+  EXPECT_EQ(canvasIndices(decoder), std::vector<uint8_t>({RED, TRANSPARENT}));
+  ASSERT_TRUE(decoder.composite(1));
+  EXPECT_EQ(canvasIndices(decoder), std::vector<uint8_t>({RED, GREEN}));
+}
+
+TEST(GifDecoderTest, ClipsFramesToCanvas) {
+  GifDecoder decoder(buildGif(2, 2, {{1, 1, 2, 2, {RED, GREEN, BLUE, RED}}}));
+
+  ASSERT_TRUE(decoder.composite(0));
+  EXPECT_EQ(canvasIndices(decoder),
+            std::vector<uint8_t>({TRANSPARENT, TRANSPARENT, TRANSPARENT, RED}));
+}
+
+}  // namespace cszb_scoreboard::test
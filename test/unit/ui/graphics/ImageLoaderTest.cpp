@@ -0,0 +1,195 @@
+/*
+test/unit/ui/graphics/ImageLoaderTest.cpp: Tests for ui/graphics/ImageLoader
+
+Copyright 2026 Tracy Beck
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+*/
+
+#include <gtest/gtest.h>
+#include <wx/image.h>  // for wxBITMAP_TYPE_BMP
+
+#include <filesystem>  // for path
+#include <fstream>     // for ofstream
+#include <functional>  // for function
+#include <memory>      // for shared_ptr, weak_ptr
+#include <optional>    // for optional
+#include <string>      // for string
+#include <vector>      // for vector
+
+#include "config/Position.h"           // for Size
+#include "test/util/TaskQueue.h"       // for TaskQueue
+#include "test/util/TempFilesystem.h"  // for TempFilesystem
+#include "ui/graphics/ImageLoader.h"   // for ImageLoader
+#include "ui/widget/Image.h"           // for Image
+#include "util/Base64.h"               // for Base64
+#include "util/FilesystemPath.h"       // for FilesystemPath
+#include "util/Singleton.h"            // for SingletonClass
+
+// IWYU pragma: no_include "gmock/gmock.h"
+// IWYU pragma: no_include "gtest/gtest.h"
+// IWYU pragma: no_include <gtest/gtest_pred_impl.h>
+// IWYU pragma: no_include "gtest/gtest_pred_impl.h"
+
+namespace cszb_scoreboard::test {
+
+// A 2-frame 1x1 animated GIF.
+const std::string GIF_BASE64 =
+    "R0lGODlhAQABAIAAAAAAAP///yH/"
+    "C05FVFNDQVBFMi4wAwEAAAAh+"
+    "QQACgAAACwAAAAAAQABAAACAkQBACH5BAAKAAAALAAAAAABAAEAAAICTAEAOw==";
+
+class ImageLoaderTest : public ::testing::Test {
+ protected:
+  TempFilesystem filesystem;
+  TaskQueue tasks;
+  ImageLoader loader{SingletonClass{}, 1, tasks.dispatcher()};
+  FilesystemPath gif_file;
+  FilesystemPath missing_file;
+
+  void SetUp() override {
+    std::vector<char> data;
+    Base64::decode(GIF_BASE64, &data);
+    std::filesystem::path path = filesystem.getRoot() / "animated.gif";
+    std::ofstream file(path, std::ios::binary);
+    file.write(data.data(), static_cast<std::streamsize>(data.size()));
+    file.close();
+    gif_file = FilesystemPath(path.string());
+    missing_file =
+        FilesystemPath((filesystem.getRoot() / "missing.png").string());
+  }
+};
+
+TEST_F(ImageLoaderTest, CompletesThroughDispatcher) {
+  std::optional<Image> loaded;
+  ImageLoader::Request request = loader.load(
+      gif_file, [&loaded](const Image& image) -> void { loaded = image; });
+
+  std::function<void()> completion = tasks.next();
+  // Nothing is delivered until the dispatched task runs.
+  EXPECT_TRUE(request.isPending());
+  EXPECT_FALSE(request.isReady());
+  EXPECT_FALSE(request.image().has_value());
+  EXPECT_FALSE(loaded.has_value());
+
+  completion();
+  ASSERT_TRUE(loaded.has_value());
+  EXPECT_TRUE(loaded->isOk());
+  EXPECT_TRUE(loaded->isAnimated());
+  EXPECT_EQ(loaded->size().width, 1);
+  EXPECT_EQ(loaded->size().height, 1);
+  EXPECT_FALSE(request.isPending());
+  EXPECT_TRUE(request.isReady());
+  ASSERT_TRUE(request.image().has_value());
+  EXPECT_TRUE(request.image()->isOk());
+}
+
+TEST_F(ImageLoaderTest, CompletionDoesNotHoldJob) {
+  auto token = std::make_shared<int>(0);
+  std::weak_ptr<int> watched = token;
+  std::function<void()> completion;
+  {
+    ImageLoader::Request request =
+        loader.load(gif_file, [token](const Image& image) -> void {});
+    token.reset();
+    completion = tasks.next();
+    completion();
+  }
+  // Once the request is gone, so is its job, even though the task which
+  // delivered it is still around to be destroyed wherever it was copied to.
+  EXPECT_TRUE(watched.expired());
+}
+
+TEST_F(ImageLoaderTest, LimitsImagesToLargestDisplay) {
+  ImageLoader limited{SingletonClass{}, 1, tasks.dispatcher(),
+                      []() -> std::optional<Size> {
+                        return Size{.width = 4, .height = 4};
+                      }};
+  std::string large_file = (filesystem.getRoot() / "large.bmp").string();
+  Image(Size{.width = 16, .height = 8})
+      .wx()
+      .SaveFile(large_file, wxBITMAP_TYPE_BMP);
+
+  ImageLoader::Request request = limited.load(FilesystemPath(large_file));
+  tasks.next()();
+  ASSERT_TRUE(request.image().has_value());
+  EXPECT_EQ(request.image()->size().width, 4);
+  EXPECT_EQ(request.image()->size().height, 2);
+
+  // Smaller images are left as they are.
+  request = limited.load(gif_file);
+  tasks.next()();
+  ASSERT_TRUE(request.image().has_value());
+  EXPECT_EQ(request.image()->size().width, 1);
+  EXPECT_EQ(request.image()->size().height, 1);
+}
+
+TEST_F(ImageLoaderTest, MissingFileCompletesWithEmptyImage) {
+  std::optional<Image> loaded;
+  ImageLoader::Request request = loader.load(
+      missing_file, [&loaded](const Image& image) -> void { loaded = image; });
+
+  tasks.next()();
+  ASSERT_TRUE(loaded.has_value());
+  EXPECT_FALSE(loaded->isOk());
+  EXPECT_TRUE(request.isReady());
+}
+
+TEST_F(ImageLoaderTest, CanceledRequestIsNotDelivered) {
+  bool called = false;
+  ImageLoader::Request request = loader.load(
+      gif_file, [&called](const Image& image) -> void { called = true; });
+
+  std::function<void()> completion = tasks.next();
+  request.cancel();
+  completion();
+  EXPECT_FALSE(called);
+  EXPECT_FALSE(request.isPending());
+  EXPECT_FALSE(request.isReady());
+}
+
+TEST_F(ImageLoaderTest, ReplacedRequestIsNotDelivered) {
+  int first_calls = 0;
+  int second_calls = 0;
+  ImageLoader::Request request = loader.load(
+      gif_file, [&first_calls](const Image& image) -> void { first_calls++; });
+  std::function<void()> first_completion = tasks.next();
+
+  request = loader.load(gif_file, [&second_calls](const Image& image) -> void {
+    second_calls++;
+  });
+  std::function<void()> second_completion = tasks.next();
+
+  first_completion();
+  second_completion();
+  EXPECT_EQ(first_calls, 0);
+  EXPECT_EQ(second_calls, 1);
+  EXPECT_TRUE(request.isReady());
+}
+
+TEST_F(ImageLoaderTest, DroppedRequestIsNotDelivered) {
+  bool called = false;
+  {
+    ImageLoader::Request request = loader.load(
+        gif_file, [&called](const Image& image) -> void { called = true; });
+  }
+  // The job may have been skipped entirely, so queue another behind it to know
+  // when the first has been dealt with.
+  ImageLoader::Request later = loader.load(gif_file);
+  while (!later.isReady()) {
+    tasks.next()();
+  }
+  EXPECT_FALSE(called);
+}
+
+}  // namespace cszb_scoreboard::test
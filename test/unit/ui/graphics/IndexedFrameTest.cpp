@@ -0,0 +1,108 @@
+/*
+test/unit/ui/graphics/IndexedFrameTest.cpp: Tests for ui/graphics/IndexedFrame
+
+Copyright 2026 Tracy Beck
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+*/
+
+#include <gtest/gtest.h>
+
+#include <cstddef>   // for size_t
+#include <optional>  // for optional
+#include <vector>    // for vector
+
+#include "ui/graphics/IndexedFrame.h"  // for IndexedFrame
+
+// IWYU pragma: no_include "gmock/gmock.h"
+// IWYU pragma: no_include "gtest/gtest.h"
+// IWYU pragma: no_include <gtest/gtest_pred_impl.h>
+// IWYU pragma: no_include "gtest/gtest_pred_impl.h"
+
+namespace cszb_scoreboard::test {
+
+TEST(IndexedFrameTest, RoundTripsPixels) {
+  std::vector<unsigned char> rgb = {
+      255, 0,  0,    // red
+      255, 0,  0,    // red
+      0,   0,  255,  // translucent blue
+      10,  20, 30,   // something else
+      255, 0,  0,    // red
+      0,   0,  255,  // translucent blue
+  };
+  std::vector<unsigned char> alpha = {255, 255, 128, 255, 255, 128};
+
+  std::optional<IndexedFrame> frame =
+      IndexedFrame::fromPixels(rgb.data(), alpha.data(), alpha.size());
+  ASSERT_TRUE(frame.has_value());
+  EXPECT_EQ(frame->pixelCount(), 6);
+  EXPECT_EQ(frame->colorCount(), 3);
+  // A byte per pixel, plus four bytes per color.
+  EXPECT_EQ(frame->bytes(), 6 + 3 * 4);
+
+  std::vector<unsigned char> expanded_rgb(rgb.size());
+  std::vector<unsigned char> expanded_alpha(alpha.size());
+  frame->expand(expanded_rgb.data(), expanded_alpha.data());
+  EXPECT_EQ(expanded_rgb, rgb);
+  EXPECT_EQ(expanded_alpha, alpha);
+}
+
+TEST(IndexedFrameTest, TransparentPixelsShareAColor) {
+  std::vector<unsigned char> rgb = {1, 2, 3, 4, 5, 6, 7, 8, 9};
+  std::vector<unsigned char> alpha = {0, 0, 255};
+
+  std::optional<IndexedFrame> frame =
+      IndexedFrame::fromPixels(rgb.data(), alpha.data(), alpha.size());
+  ASSERT_TRUE(frame.has_value());
+  EXPECT_EQ(frame->colorCount(), 2);
+
+  std::vector<unsigned char> expanded_rgb(rgb.size());
+  std::vector<unsigned char> expanded_alpha(alpha.size());
+  frame->expand(expanded_rgb.data(), expanded_alpha.data());
+  EXPECT_EQ(expanded_alpha, alpha);
+  EXPECT_EQ(expanded_rgb[6], 7);
+  EXPECT_EQ(expanded_rgb[7], 8);
+  EXPECT_EQ(expanded_rgb[8], 9);
+}
+
+TEST(IndexedFrameTest, MissingAlphaIsOpaque) {
+  std::vector<unsigned char> rgb = {1, 2, 3, 1, 2, 3};
+
+  std::optional<IndexedFrame> frame =
+      IndexedFrame::fromPixels(rgb.data(), nullptr, 2);
+  ASSERT_TRUE(frame.has_value());
+
+  std::vector<unsigned char> expanded_rgb(rgb.size());
+  std::vector<unsigned char> expanded_alpha(2);
+  frame->expand(expanded_rgb.data(), expanded_alpha.data());
+  EXPECT_EQ(expanded_rgb, rgb);
+  EXPECT_EQ(expanded_alpha, std::vector<unsigned char>({255, 255}));
+}
+
+TEST(IndexedFrameTest, TooManyColors) {
+  constexpr size_t PIXELS = IndexedFrame::MAX_COLORS + 1;
+  std::vector<unsigned char> rgb(PIXELS * 3);
+  std::vector<unsigned char> alpha(PIXELS, 255);
+  for (size_t i = 0; i < PIXELS; ++i) {
+    rgb[i * 3] = static_cast<unsigned char>(i);
+    rgb[i * 3 + 1] = static_cast<unsigned char>(i / 256);
+  }
+
+  EXPECT_FALSE(
+      IndexedFrame::fromPixels(rgb.data(), alpha.data(), PIXELS).has_value());
+  // One fewer color fits exactly.
+  EXPECT_TRUE(IndexedFrame::fromPixels(rgb.data(), alpha.data(), PIXELS - 1)
+                  .has_value());
+}
+
+}  // namespace cszb_scoreboard::test
@@ -0,0 +1,220 @@
+/*
+test/unit/ui/graphics/PixelKernelsTest.cpp: Tests for ui/graphics/PixelKernels
+
+Copyright 2026 Tracy Beck
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+*/
+
+#include <gtest/gtest.h>
+
+#include <cstddef>  // for size_t
+#include <cstdlib>  // for abs
+#include <random>   // for mt19937, uniform_int_distribution
+#include <vector>   // for vector
+
+#include "ui/graphics/PixelKernels.h"  // for PixelKernels
+
+// IWYU pragma: no_include "gmock/gmock.h"
+// IWYU pragma: no_include "gtest/gtest.h"
+// IWYU pragma: no_include <gtest/gtest_pred_impl.h>
+// IWYU pragma: no_include "gtest/gtest_pred_impl.h"
+
+namespace cszb_scoreboard::test {
+
+// Lengths which cover runs shorter than a vector, exact multiples of both
+// vector widths, and a remainder after whole vectors.
+const std::vector<size_t> RUN_LENGTHS = {0, 1, 15, 16, 17, 32, 63, 100, 1000};
+
+// The scalar floating point blend which PixelKernels::blend replaces.
+void referenceBlend(unsigned char* bg_rgb, unsigned char* bg_alpha,
+                    const unsigned char* fg_rgb, const unsigned char* fg_alpha,
+                    size_t count) {
+  for (size_t i = 0; i < count; ++i) {
+    unsigned char alpha = fg_alpha[i];
+    if (alpha == 0) {
+      continue;
+    }
+    if (alpha == 255) {
+      for (size_t c = 0; c < 3; ++c) {
+        bg_rgb[i * 3 + c] = fg_rgb[i * 3 + c];
+      }
+      bg_alpha[i] = 255;
+      continue;
+    }
+    float a = static_cast<float>(alpha) / 255.0F;
+    float bg_a = static_cast<float>(bg_alpha[i]) / 255.0F;
+    float out_a = a + bg_a * (1.0F - a);
+    for (size_t c = 0; c < 3; ++c) {
+      bg_rgb[i * 3 + c] = static_cast<unsigned char>(
+          (fg_rgb[i * 3 + c] * a + bg_rgb[i * 3 + c] * bg_a * (1.0F - a)) /
+          out_a);
+    }
+    bg_alpha[i] = static_cast<unsigned char>(out_a * 255.0F);
+  }
+}
+
+class PixelKernelsTest : public ::testing::TestWithParam<PixelKernels::Path> {
+ protected:
+  std::mt19937 random{42};  // NOLINT(cert-msc32-c,cert-msc51-cpp)
+
+  void SetUp() override {
+    original_path = PixelKernels::path();
+    if (!PixelKernels::isSupported(GetParam())) {
+      GTEST_SKIP() << "Not supported on this CPU";
+    }
+    PixelKernels::usePath(GetParam());
+  }
+
+  void TearDown() override { PixelKernels::usePath(original_path); }
+
+  auto randomBytes(size_t count) -> std::vector<unsigned char> {
+    std::uniform_int_distribution<int> byte(0, 255);
+    std::vector<unsigned char> bytes(count);
+    for (auto& value : bytes) {
+      value = static_cast<unsigned char>(byte(random));
+    }
+    return bytes;
+  }
+
+  // Alpha values in runs of fully transparent, fully opaque and partially
+  // transparent pixels, so that every kind of block is exercised.
+  auto alphaRuns(size_t count) -> std::vector<unsigned char> {
+    std::uniform_int_distribution<int> kind(0, 2);
+    std::uniform_int_distribution<int> run_length(1, 48);
+    std::uniform_int_distribution<int> byte(0, 255);
+    std::vector<unsigned char> alpha;
+    while (alpha.size() < count) {
+      int run_kind = kind(random);
+      int length = run_length(random);
+      for (int i = 0; i < length && alpha.size() < count; ++i) {
+        alpha.push_back(run_kind == 0   ? 0
+                        : run_kind == 1 ? 255
+                                        : static_cast<unsigned char>(
+                                              byte(random)));
+      }
+    }
+    return alpha;
+  }
+
+ private:
+  PixelKernels::Path original_path = PixelKernels::Path::Portable;
+};
+
+TEST_P(PixelKernelsTest, BlendMatchesFloatingPoint) {
+  for (size_t count : RUN_LENGTHS) {
+    std::vector<unsigned char> fg_rgb = randomBytes(count * 3);
+    std::vector<unsigned char> fg_alpha = alphaRuns(count);
+    std::vector<unsigned char> bg_rgb = randomBytes(count * 3);
+    std::vector<unsigned char> bg_alpha = alphaRuns(count);
+    std::vector<unsigned char> expected_rgb = bg_rgb;
+    std::vector<unsigned char> expected_alpha = bg_alpha;
+
+    referenceBlend(expected_rgb.data(), expected_alpha.data(), fg_rgb.data(),
+                   fg_alpha.data(), count);
+    PixelKernels::blend(bg_rgb.data(), bg_alpha.data(), fg_rgb.data(),
+                        fg_alpha.data(), count);
+
+    // The integer math is exact, where the floating point math it replaces
+    // can round down a whole step.
+    for (size_t i = 0; i < count * 3; ++i) {
+      EXPECT_LE(std::abs(bg_rgb[i] - expected_rgb[i]), 1)
+          << "length " << count << ", byte " << i;
+    }
+    for (size_t i = 0; i < count; ++i) {
+      EXPECT_LE(std::abs(bg_alpha[i] - expected_alpha[i]), 1)
+          << "length " << count << ", pixel " << i;
+    }
+  }
+}
+
+TEST_P(PixelKernelsTest, BlendWithoutAlphaCopies) {
+  std::vector<unsigned char> fg_rgb = randomBytes(100 * 3);
+  std::vector<unsigned char> bg_rgb = randomBytes(100 * 3);
+  std::vector<unsigned char> bg_alpha = randomBytes(100);
+
+  PixelKernels::blend(bg_rgb.data(), bg_alpha.data(), fg_rgb.data(), nullptr,
+                      100);
+
+  EXPECT_EQ(bg_rgb, fg_rgb);
+  EXPECT_EQ(bg_alpha, std::vector<unsigned char>(100, 255));
+}
+
+TEST_P(PixelKernelsTest, MaskToAlpha) {
+  for (size_t count : RUN_LENGTHS) {
+    // Runs of the mask color between runs of random colors, with a few
+    // near-misses which only differ from it in a single channel.
+    std::vector<unsigned char> mask_runs = alphaRuns(count);
+    std::vector<unsigned char> rgb = randomBytes(count * 3);
+    for (size_t i = 0; i < count; ++i) {
+      if (mask_runs[i] == 0) {
+        rgb[i * 3] = 1;
+        rgb[i * 3 + 1] = 2;
+        rgb[i * 3 + 2] = 3;
+      } else if (mask_runs[i] < 8) {
+        rgb[i * 3] = 1;
+        rgb[i * 3 + 1] = 2;
+      }
+    }
+    std::vector<unsigned char> alpha(count, 7);
+
+    PixelKernels::maskToAlpha(rgb.data(), alpha.data(), count, 1, 2, 3);
+
+    for (size_t i = 0; i < count; ++i) {
+      bool masked =
+          rgb[i * 3] == 1 && rgb[i * 3 + 1] == 2 && rgb[i * 3 + 2] == 3;
+      EXPECT_EQ(alpha[i], masked ? 0 : 255)
+          << "length " << count << ", pixel " << i;
+    }
+  }
+}
+
+TEST_P(PixelKernelsTest, ClampAlpha) {
+  for (size_t count : RUN_LENGTHS) {
+    std::vector<unsigned char> alpha = randomBytes(count);
+    std::vector<unsigned char> expected = alpha;
+    for (auto& value : expected) {
+      if (value > 100) {
+        value = 100;
+      }
+    }
+
+    PixelKernels::clampAlpha(alpha.data(), count, 100);
+
+    EXPECT_EQ(alpha, expected) << "length " << count;
+  }
+}
+
+TEST_P(PixelKernelsTest, Tint) {
+  for (size_t count : RUN_LENGTHS) {
+    // One extra pixel past the end of the run, which should be left alone.
+    std::vector<unsigned char> rgb((count + 1) * 3, 0);
+    std::vector<unsigned char> expected = rgb;
+    for (size_t i = 0; i < count; ++i) {
+      expected[i * 3] = 10;
+      expected[i * 3 + 1] = 20;
+      expected[i * 3 + 2] = 30;
+    }
+
+    PixelKernels::tint(rgb.data(), count, 10, 20, 30);
+
+    EXPECT_EQ(rgb, expected) << "length " << count;
+  }
+}
+
+INSTANTIATE_TEST_SUITE_P(AllPaths, PixelKernelsTest,
+                         ::testing::Values(PixelKernels::Path::Portable,
+                                           PixelKernels::Path::SSE2,
+                                           PixelKernels::Path::AVX2));
+
+}  // namespace cszb_scoreboard::test
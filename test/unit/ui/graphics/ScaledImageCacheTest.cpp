@@ -0,0 +1,116 @@
+/*
+test/unit/ui/graphics/ScaledImageCacheTest.cpp: Tests for
+ui/graphics/ScaledImageCache
+
+Copyright 2026 Tracy Beck
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+*/
+
+#include <gtest/gtest.h>
+
+#include "config/Position.h"               // for Size
+#include "ui/graphics/Color.h"             // for Color
+#include "ui/graphics/ScaledImageCache.h"  // for ScaledImageCache
+#include "ui/widget/Image.h"               // for Image
+#include "util/Singleton.h"                // for SingletonClass
+
+// IWYU pragma: no_include "gmock/gmock.h"
+// IWYU pragma: no_include "gtest/gtest.h"
+// IWYU pragma: no_include <gtest/gtest_pred_impl.h>
+// IWYU pragma: no_include "gtest/gtest_pred_impl.h"
+
+namespace cszb_scoreboard::test {
+
+const Size SOURCE_SIZE{.width = 8, .height = 4};
+const Size TARGET_SIZE{.width = 4, .height = 4};
+// A 4x2 RGB image.
+constexpr size_t SCALED_BYTES = 4 * 2 * 3;
+
+TEST(ScaledImageCacheTest, ReusesScaledImage) {
+  ScaledImageCache cache(SingletonClass{}, SCALED_BYTES * 4);
+  Image source(SOURCE_SIZE);
+
+  Image first = cache.scaledToFit(source, TARGET_SIZE);
+  EXPECT_EQ(first.size().width, 4);
+  EXPECT_EQ(first.size().height, 2);
+  EXPECT_EQ(cache.usage(), SCALED_BYTES);
+
+  // A copy of the source is the same image, so it shares the scaled copy.
+  Image copy = source;
+  Image second = cache.scaledToFit(copy, TARGET_SIZE);
+  EXPECT_EQ(second.wx().GetData(), first.wx().GetData());
+  EXPECT_EQ(cache.size(), 1);
+}
+
+TEST(ScaledImageCacheTest, SizesAreCachedSeparately) {
+  ScaledImageCache cache(SingletonClass{}, SCALED_BYTES * 4);
+  Image source(SOURCE_SIZE);
+
+  Image small = cache.scaledToFit(source, TARGET_SIZE);
+  Image large = cache.scaledToFit(source, Size{.width = 6, .height = 6});
+  EXPECT_EQ(large.size().width, 6);
+  EXPECT_EQ(large.size().height, 3);
+  EXPECT_EQ(cache.size(), 2);
+  EXPECT_EQ(cache.scaledToFit(source, TARGET_SIZE).wx().GetData(),
+            small.wx().GetData());
+}
+
+TEST(ScaledImageCacheTest, ModifiedImageIsScaledAgain) {
+  ScaledImageCache cache(SingletonClass{}, SCALED_BYTES * 4);
+  Image source(SOURCE_SIZE);
+
+  Image before = cache.scaledToFit(source, TARGET_SIZE);
+  source.color(Color(255, 0, 0));
+  Image after = cache.scaledToFit(source, TARGET_SIZE);
+  EXPECT_NE(after.wx().GetData(), before.wx().GetData());
+  EXPECT_EQ(after.red(0, 0), 255);
+}
+
+TEST(ScaledImageCacheTest, ModifyingResultLeavesCacheIntact) {
+  ScaledImageCache cache(SingletonClass{}, SCALED_BYTES * 4);
+  Image source(SOURCE_SIZE);
+
+  Image tinted = cache.scaledToFit(source, TARGET_SIZE);
+  tinted.color(Color(255, 0, 0));
+  EXPECT_EQ(tinted.red(0, 0), 255);
+  EXPECT_EQ(cache.scaledToFit(source, TARGET_SIZE).red(0, 0), 0);
+}
+
+TEST(ScaledImageCacheTest, EvictsOverBudget) {
+  ScaledImageCache cache(SingletonClass{}, SCALED_BYTES);
+  Image first(SOURCE_SIZE);
+  Image second(SOURCE_SIZE);
+
+  cache.scaledToFit(first, TARGET_SIZE);
+  cache.scaledToFit(second, TARGET_SIZE);
+  EXPECT_EQ(cache.size(), 1);
+  EXPECT_EQ(cache.usage(), SCALED_BYTES);
+
+  // Shrinking the budget drops everything but the most recent image.
+  cache.scaledToFit(first, Size{.width = 6, .height = 6});
+  cache.setBudget(0);
+  EXPECT_EQ(cache.size(), 1);
+  EXPECT_EQ(cache.budget(), 0);
+}
+
+TEST(ScaledImageCacheTest, FittedImageIsNotCached) {
+  ScaledImageCache cache(SingletonClass{}, SCALED_BYTES * 4);
+  Image source(Size{.width = 4, .height = 2});
+
+  Image scaled = cache.scaledToFit(source, TARGET_SIZE);
+  EXPECT_EQ(scaled.wx().GetData(), source.wx().GetData());
+  EXPECT_EQ(cache.size(), 0);
+}
+
+}  // namespace cszb_scoreboard::test
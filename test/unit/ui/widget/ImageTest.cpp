@@ -87,6 +87,27 @@ TEST_F(ImageTest, AnimatedImageLoadingAndPlayback) {
   EXPECT_EQ(scaled_frame.GetHeight(), 4);
 }
 
+TEST_F(ImageTest, ScaledFramesAreShared) {
+  wxLogNull logNo;
+  std::vector<char> data;
+  Base64::decode(ANIMATED_GIF_BASE64, &data);
+  Image image(data);
+  Image first = image;
+  Image second = image;
+  first.rescale(4, 4);
+  second.rescale(4, 4);
+
+  // Each frame is scaled once, and reused by every copy shown at that size.
+  wxImage frame = first.animate(0);
+  EXPECT_EQ(first.animate(0).GetData(), frame.GetData());
+  EXPECT_EQ(second.animate(0).GetData(), frame.GetData());
+
+  // Other sizes are scaled separately.
+  second.rescale(2, 2);
+  EXPECT_EQ(second.animate(0).GetWidth(), 2);
+  EXPECT_EQ(first.animate(0).GetData(), frame.GetData());
+}
+
 TEST_F(ImageTest, SetColorWorks) {
   wxLogNull logNo;
   Image image(Size{.width = 10, .height = 10});
@@ -101,4 +122,46 @@ TEST_F(ImageTest, SetColorWorks) {
   EXPECT_EQ(image.blue(0, 0), color.Blue());
 }
 
+TEST_F(ImageTest, SetColorLeavesCopiesAlone) {
+  wxLogNull logNo;
+  Image image(Size{.width = 10, .height = 10});
+  Image copy = image;
+
+  Color color("Red");
+  copy.color(color);
+  EXPECT_EQ(copy.red(0, 0), color.Red());
+  EXPECT_EQ(image.red(0, 0), 0);
+  EXPECT_EQ(image.green(0, 0), 0);
+  EXPECT_EQ(image.blue(0, 0), 0);
+}
+
+TEST_F(ImageTest, ContentIdFollowsContent) {
+  wxLogNull logNo;
+  Image image(Size{.width = 10, .height = 10});
+  Image copy = image;
+  EXPECT_EQ(copy.contentId(), image.contentId());
+  EXPECT_NE(Image(Size{.width = 10, .height = 10}).contentId(),
+            image.contentId());
+
+  copy.color(Color("Red"));
+  EXPECT_NE(copy.contentId(), image.contentId());
+  copy.rescale(5, 5);
+  EXPECT_NE(copy.contentId(), image.contentId());
+}
+
+TEST_F(ImageTest, ContentIdOfLoadedImages) {
+  wxLogNull logNo;
+  std::vector<char> still_data;
+  Base64::decode(STATIC_GIF_BASE64, &still_data);
+  std::vector<char> animated_data;
+  Base64::decode(ANIMATED_GIF_BASE64, &animated_data);
+
+  // Loading the same still image twice gives the same image.
+  EXPECT_EQ(Image(still_data).contentId(), Image(still_data).contentId());
+  EXPECT_NE(Image(still_data).contentId(), Image(animated_data).contentId());
+  // But animations play from when they're loaded, so each load is distinct.
+  EXPECT_NE(Image(animated_data).contentId(),
+            Image(animated_data).contentId());
+}
+
 }  // namespace cszb_scoreboard::test
@@ -0,0 +1,214 @@
+/*
+test/unit/ui/widget/LayerCompositorTest.cpp: Tests for
+ui/widget/LayerCompositor
+
+Copyright 2026 Tracy Beck
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+*/
+
+#include <gtest/gtest.h>  // for TestInfo (ptr only)
+#include <wx/bitmap.h>    // for wxBitmap
+#include <wx/dcmemory.h>  // for wxMemoryDC
+#include <wx/image.h>     // for wxImage
+
+#include <array>     // for array
+#include <cstddef>   // for size_t
+#include <memory>    // for unique_ptr
+#include <optional>  // for optional
+#include <string>    // for string, to_string
+#include <vector>    // for vector
+
+#include "config/Position.h"            // for Position, Size
+#include "ui/graphics/Color.h"          // for Color
+#include "ui/widget/Image.h"            // for Image
+#include "ui/widget/LayerCompositor.h"  // for LayerCompositor
+#include "ui/widget/RenderContext.h"    // for RenderContext
+
+// IWYU pragma: no_include "gmock/gmock.h"
+// IWYU pragma: no_include "gtest/gtest.h"
+// IWYU pragma: no_include <gtest/gtest_pred_impl.h>
+// IWYU pragma: no_include "gtest/gtest_pred_impl.h"
+
+namespace cszb_scoreboard::test {
+
+constexpr size_t LAYER_COUNT = 4;
+constexpr size_t BACKGROUND = 0;
+constexpr size_t OVERLAY = 1;
+constexpr size_t TIMER = 3;
+const Size SIDE_SIZE{.width = 8, .height = 8};
+const LayerCompositor::Bounds OVERLAY_AREA{
+    .origin = Position{.x = 2, .y = 2}, .size = Size{.width = 2, .height = 2}};
+const LayerCompositor::Bounds TIMER_AREA{
+    .origin = Position{.x = 0, .y = 6}, .size = Size{.width = 8, .height = 2}};
+
+class LayerCompositorTest : public ::testing::Test {
+ protected:
+  LayerCompositor compositor{LAYER_COUNT};
+  std::vector<LayerCompositor::LayerRenderer> renderers;
+  // How many times each layer has been rendered.
+  std::array<int, LAYER_COUNT> renders{};
+  // The color each layer draws in, if it draws anything.
+  std::array<std::optional<Color>, LAYER_COUNT> colors;
+  // The area each layer draws within, which is recorded as its bounds.  Layers
+  // without an area fill the whole side.
+  std::array<std::optional<LayerCompositor::Bounds>, LAYER_COUNT> areas;
+  Size side_size = SIDE_SIZE;
+  wxImage output;
+
+  void SetUp() override {
+    for (size_t layer = 0; layer < LAYER_COUNT; ++layer) {
+      renderers.emplace_back([this, layer](RenderContext* renderer) -> void {
+        renderLayer(renderer, layer);
+      });
+    }
+  }
+
+  void renderLayer(RenderContext* renderer, size_t layer) {
+    renders[layer]++;
+    LayerCompositor::Bounds area = areas[layer].value_or(
+        LayerCompositor::Bounds{.origin = Position{.x = 0, .y = 0},
+                                .size = side_size});
+    if (areas[layer].has_value()) {
+      compositor.setBounds(layer, area.origin, area.size);
+    }
+    if (colors[layer].has_value()) {
+      Image block(area.size);
+      block.color(*colors[layer]);
+      renderer->drawImage(block, area.origin.x, area.origin.y);
+    }
+  }
+
+  void composite() {
+    wxBitmap target(side_size.toWx());
+    {
+      wxMemoryDC context(target);
+      std::unique_ptr<RenderContext> renderer = RenderContext::forDC(&context);
+      compositor.composite(renderer.get(), side_size, renderers);
+    }
+    output = target.ConvertToImage();
+  }
+
+  auto pixel(int x, int y) -> Color {
+    return {output.GetRed(x, y), output.GetGreen(x, y), output.GetBlue(x, y)};
+  }
+};
+
+TEST_F(LayerCompositorTest, LowerLayersAreKeptWhileUpperLayersAnimate) {
+  colors[BACKGROUND] = Color("Red");
+  colors[OVERLAY] = Color("Blue");
+  areas[OVERLAY] = OVERLAY_AREA;
+  colors[TIMER] = Color("White");
+  areas[TIMER] = TIMER_AREA;
+  composite();
+  EXPECT_EQ(renders, (std::array<int, LAYER_COUNT>{1, 1, 1, 1}));
+
+  // Let the overlay and timer settle into animating on every frame.
+  for (int frame = 0; frame < 2; ++frame) {
+    compositor.setStamp(OVERLAY, "frame " + std::to_string(frame));
+    compositor.setStamp(TIMER, "tick " + std::to_string(frame));
+    composite();
+  }
+
+  // From then on, the background isn't drawn again however often the layers
+  // above it change.
+  int background_renders = renders[BACKGROUND];
+  int overlay_renders = renders[OVERLAY];
+  for (int frame = 2; frame < 6; ++frame) {
+    colors[OVERLAY] = Color(frame % 2 == 0 ? "Yellow" : "Blue");
+    compositor.setStamp(OVERLAY, "frame " + std::to_string(frame));
+    compositor.setStamp(TIMER, "tick " + std::to_string(frame));
+    composite();
+    EXPECT_EQ(pixel(2, 2), *colors[OVERLAY]);
+    EXPECT_EQ(pixel(0, 0), Color("Red"));
+    EXPECT_EQ(pixel(0, 7), Color("White"));
+  }
+  EXPECT_EQ(renders[BACKGROUND], background_renders);
+  EXPECT_EQ(renders[OVERLAY], overlay_renders + 4);
+
+  // Once the overlay holds still as well, the timer ticks alone.
+  for (int tick = 6; tick < 8; ++tick) {
+    compositor.setStamp(TIMER, "tick " + std::to_string(tick));
+    composite();
+  }
+  std::array<int, LAYER_COUNT> before = renders;
+  compositor.setStamp(TIMER, "tick 8");
+  composite();
+  EXPECT_EQ(renders, (std::array<int, LAYER_COUNT>{
+                         before[0], before[1], before[2], before[3] + 1}));
+  EXPECT_EQ(pixel(2, 2), *colors[OVERLAY]);
+
+  // A change to the background is drawn under everything above it.
+  colors[BACKGROUND] = Color("Green");
+  compositor.setStamp(BACKGROUND, "green");
+  composite();
+  EXPECT_EQ(renders[BACKGROUND], before[BACKGROUND] + 1);
+  EXPECT_EQ(pixel(0, 0), Color("Green"));
+  EXPECT_EQ(pixel(2, 2), *colors[OVERLAY]);
+  EXPECT_EQ(pixel(0, 7), Color("White"));
+}
+
+TEST_F(LayerCompositorTest, DamageIsRedrawnOverBlack) {
+  colors[BACKGROUND] = Color("Red");
+  colors[TIMER] = Color("White");
+  areas[TIMER] = TIMER_AREA;
+  composite();
+
+  // Only the timer's area is redrawn, starting from black.  Everything
+  // outside of it is left as it was, even though the background would now
+  // draw differently.
+  colors[BACKGROUND].reset();
+  colors[TIMER].reset();
+  compositor.setStamp(TIMER, "tick");
+  composite();
+  EXPECT_EQ(pixel(0, 7), Color("Black"));
+  EXPECT_EQ(pixel(7, 6), Color("Black"));
+  EXPECT_EQ(pixel(0, 0), Color("Red"));
+  EXPECT_EQ(pixel(7, 5), Color("Red"));
+}
+
+TEST_F(LayerCompositorTest, ResizingRedrawsEverything) {
+  colors[BACKGROUND] = Color("Red");
+  colors[TIMER] = Color("White");
+  areas[TIMER] = TIMER_AREA;
+  composite();
+  for (int tick = 0; tick < 3; ++tick) {
+    compositor.setStamp(TIMER, "tick " + std::to_string(tick));
+    composite();
+  }
+
+  std::array<int, LAYER_COUNT> before = renders;
+  side_size = Size{.width = 16, .height = 16};
+  areas[TIMER] = LayerCompositor::Bounds{
+      .origin = Position{.x = 0, .y = 14},
+      .size = Size{.width = 16, .height = 2}};
+  composite();
+  for (size_t layer = 0; layer < LAYER_COUNT; ++layer) {
+    EXPECT_EQ(renders[layer], before[layer] + 1);
+  }
+  EXPECT_EQ(pixel(12, 4), Color("Red"));
+  EXPECT_EQ(pixel(12, 15), Color("White"));
+  ASSERT_TRUE(compositor.bounds(TIMER).has_value());
+  EXPECT_EQ(compositor.bounds(TIMER)->origin.y, 14);
+
+  // Nothing drawn at the old size shows through afterwards.
+  for (int tick = 3; tick < 6; ++tick) {
+    compositor.setStamp(TIMER, "tick " + std::to_string(tick));
+    composite();
+    EXPECT_EQ(pixel(12, 4), Color("Red"));
+    EXPECT_EQ(pixel(12, 7), Color("Red"));
+    EXPECT_EQ(pixel(12, 15), Color("White"));
+  }
+}
+
+}  // namespace cszb_scoreboard::test
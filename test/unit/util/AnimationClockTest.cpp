@@ -0,0 +1,50 @@
+/*
+test/unit/util/AnimationClockTest.cpp: Tests for util/AnimationClock
+
+Copyright 2026 Tracy Beck
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+*/
+
+#include <gtest/gtest.h>
+
+#include <cstdint>   // for int64_t
+#include <optional>  // for optional, nullopt
+
+#include "util/AnimationClock.h"  // for AnimationClock
+
+// IWYU pragma: no_include "gmock/gmock.h"
+// IWYU pragma: no_include "gtest/gtest.h"
+// IWYU pragma: no_include <gtest/gtest_pred_impl.h>
+// IWYU pragma: no_include "gtest/gtest_pred_impl.h"
+
+namespace cszb_scoreboard::test {
+
+TEST(AnimationClockTest, Earliest) {
+  EXPECT_EQ(AnimationClock::earliest(std::nullopt, std::nullopt), std::nullopt);
+  EXPECT_EQ(AnimationClock::earliest(5, std::nullopt), 5);
+  EXPECT_EQ(AnimationClock::earliest(std::nullopt, 7), 7);
+  EXPECT_EQ(AnimationClock::earliest(5, 7), 5);
+  EXPECT_EQ(AnimationClock::earliest(9, 7), 7);
+}
+
+TEST(AnimationClockTest, SystemClockConversion) {
+  int64_t steady = AnimationClock::now();
+  int64_t system = AnimationClock::toSystemMillis(steady);
+  // Allow for the clocks to tick between the calls.
+  EXPECT_NEAR(AnimationClock::fromSystemMillis(system), steady, 2);
+  EXPECT_NEAR(AnimationClock::fromSystemMillis(system + 1000), steady + 1000,
+              2);
+}
+
+}  // namespace cszb_scoreboard::test
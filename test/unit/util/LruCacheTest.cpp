@@ -0,0 +1,103 @@
+/*
+test/unit/util/LruCacheTest.cpp: Tests for util/LruCache
+
+Copyright 2026 Tracy Beck
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+*/
+
+#include <gtest/gtest.h>
+
+#include <string>  // for string, allocator
+
+#include "util/LruCache.h"  // for LruCache
+
+// IWYU pragma: no_include "gmock/gmock.h"
+// IWYU pragma: no_include "gtest/gtest.h"
+// IWYU pragma: no_include <gtest/gtest_pred_impl.h>
+// IWYU pragma: no_include "gtest/gtest_pred_impl.h"
+
+namespace cszb_scoreboard::test {
+
+TEST(LruCacheTest, FindAndReplace) {
+  LruCache<std::string, int> cache(3);
+  EXPECT_EQ(cache.find("a"), nullptr);
+
+  cache.insert("a", 1);
+  ASSERT_NE(cache.find("a"), nullptr);
+  EXPECT_EQ(*cache.find("a"), 1);
+
+  cache.insert("a", 2);
+  EXPECT_EQ(*cache.find("a"), 2);
+  EXPECT_EQ(cache.size(), 1);
+
+  cache.erase("a");
+  EXPECT_EQ(cache.find("a"), nullptr);
+  EXPECT_EQ(cache.size(), 0);
+}
+
+TEST(LruCacheTest, EvictsLeastRecentlyUsed) {
+  LruCache<std::string, int> cache(3);
+  cache.insert("a", 1);
+  cache.insert("b", 2);
+  cache.insert("c", 3);
+
+  // Touching "a" makes "b" the oldest entry.
+  cache.find("a");
+  cache.insert("d", 4);
+
+  EXPECT_EQ(cache.size(), 3);
+  EXPECT_NE(cache.find("a"), nullptr);
+  EXPECT_EQ(cache.find("b"), nullptr);
+  EXPECT_NE(cache.find("c"), nullptr);
+  EXPECT_NE(cache.find("d"), nullptr);
+}
+
+TEST(LruCacheTest, EvictsByCost) {
+  LruCache<int, std::string> cache(10);
+  cache.insert(1, "one", 4);
+  cache.insert(2, "two", 4);
+  EXPECT_EQ(cache.cost(), 8);
+
+  cache.insert(3, "three", 4);
+  EXPECT_EQ(cache.find(1), nullptr);
+  EXPECT_EQ(cache.cost(), 8);
+
+  // An entry larger than the whole cache is kept until something else is
+  // added.
+  cache.insert(4, "four", 20);
+  EXPECT_EQ(cache.size(), 1);
+  EXPECT_NE(cache.find(4), nullptr);
+
+  cache.insert(5, "five", 1);
+  EXPECT_EQ(cache.find(4), nullptr);
+  EXPECT_EQ(cache.cost(), 1);
+}
+
+TEST(LruCacheTest, ShrinkingCapacityEvicts) {
+  LruCache<int, int> cache(4);
+  for (int i = 0; i < 4; ++i) {
+    cache.insert(i, i);
+  }
+  cache.setCapacity(2);
+  EXPECT_EQ(cache.size(), 2);
+  EXPECT_EQ(cache.find(0), nullptr);
+  EXPECT_EQ(cache.find(1), nullptr);
+  EXPECT_NE(cache.find(3), nullptr);
+
+  cache.clear();
+  EXPECT_EQ(cache.size(), 0);
+  EXPECT_EQ(cache.cost(), 0);
+}
+
+}  // namespace cszb_scoreboard::test
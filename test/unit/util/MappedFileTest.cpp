@@ -0,0 +1,66 @@
+/*
+test/unit/util/MappedFileTest.cpp: Tests for util/MappedFile
+
+Copyright 2026 Tracy Beck
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+*/
+
+#include <gtest/gtest.h>
+
+#include <string>  // for string, allocator
+
+#include "test/util/TempFilesystem.h"  // for TempFilesystem
+#include "util/FilesystemPath.h"       // for FilesystemPath
+#include "util/MappedFile.h"           // for MappedFile
+
+// IWYU pragma: no_include "gmock/gmock.h"
+// IWYU pragma: no_include "gtest/gtest.h"
+// IWYU pragma: no_include <gtest/gtest_pred_impl.h>
+// IWYU pragma: no_include "gtest/gtest_pred_impl.h"
+
+namespace cszb_scoreboard::test {
+
+TEST(MappedFileTest, ReadsContents) {
+  TempFilesystem filesystem;
+  std::string contents("binary\0data", 11);
+  filesystem.createFile("file.bin", contents);
+
+  MappedFile file(
+      FilesystemPath((filesystem.getRoot() / "file.bin").string()));
+
+  ASSERT_TRUE(file.isOk());
+  EXPECT_EQ(std::string(file.data(), file.size()), contents);
+}
+
+TEST(MappedFileTest, EmptyFile) {
+  TempFilesystem filesystem;
+  filesystem.createFile("empty.bin", "");
+
+  MappedFile file(
+      FilesystemPath((filesystem.getRoot() / "empty.bin").string()));
+
+  EXPECT_TRUE(file.isOk());
+  EXPECT_EQ(file.size(), 0);
+}
+
+TEST(MappedFileTest, MissingFile) {
+  TempFilesystem filesystem;
+
+  MappedFile file(
+      FilesystemPath((filesystem.getRoot() / "missing.bin").string()));
+
+  EXPECT_FALSE(file.isOk());
+}
+
+}  // namespace cszb_scoreboard::test
@@ -0,0 +1,80 @@
+/*
+test/unit/util/NgramIndexTest.cpp: Tests for util/NgramIndex
+
+Copyright 2026 Tracy Beck
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+*/
+
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+
+#include "util/NgramIndex.h"  // for NgramIndex
+
+// IWYU pragma: no_include "gmock/gmock.h"
+// IWYU pragma: no_include "gtest/gtest.h"
+// IWYU pragma: no_include <gtest/gtest_pred_impl.h>
+// IWYU pragma: no_include "gtest/gtest_pred_impl.h"
+
+namespace cszb_scoreboard::test {
+
+using ::testing::ElementsAre;
+
+TEST(NgramIndexTest, ShortQueriesAreExact) {
+  NgramIndex<int> index;
+  index.insert("dog", 3);
+  index.insert("cute", 1);
+  index.insert("tall", 2);
+
+  EXPECT_THAT(index.candidates("t"), ElementsAre(1, 2));
+  EXPECT_THAT(index.candidates("og"), ElementsAre(3));
+  EXPECT_THAT(index.candidates("all"), ElementsAre(2));
+  EXPECT_TRUE(index.candidates("x").empty());
+  EXPECT_TRUE(index.candidates("ta ").empty());
+}
+
+TEST(NgramIndexTest, LongQueriesNarrowCandidates) {
+  NgramIndex<int> index;
+  index.insert("capybara", 1);
+  index.insert("bar", 2);
+  index.insert("arab", 3);
+  index.insert("abaxbab", 4);
+  index.insert("barbara", 5);
+
+  EXPECT_THAT(index.candidates("bara"), ElementsAre(1, 5));
+  EXPECT_TRUE(index.candidates("capybaras").empty());
+  // Contains both "aba" and "bab", though not "abab", so must be checked.
+  EXPECT_THAT(index.candidates("abab"), ElementsAre(4));
+}
+
+TEST(NgramIndexTest, EraseRemovesOnlyThatId) {
+  NgramIndex<int> index;
+  index.insert("short", 1);
+  index.insert("short", 2);
+  index.insert("stall", 3);
+
+  index.erase("short", 1);
+  EXPECT_THAT(index.candidates("s"), ElementsAre(2, 3));
+  EXPECT_THAT(index.candidates("hort"), ElementsAre(2));
+
+  index.erase("short", 2);
+  EXPECT_TRUE(index.candidates("hort").empty());
+  // Erasing something never added is harmless.
+  index.erase("stall", 4);
+  EXPECT_THAT(index.candidates("stall"), ElementsAre(3));
+
+  index.clear();
+  EXPECT_TRUE(index.candidates("s").empty());
+}
+
+}  // namespace cszb_scoreboard::test
@@ -48,6 +48,8 @@ TEST(SingletonTest, GettersReturnNonNull) {
   EXPECT_NE(singleton->teamColors(), nullptr);
   EXPECT_NE(singleton->hotkeyTable(), nullptr);
   EXPECT_NE(singleton->imageLibrary(), nullptr);
+  EXPECT_NE(singleton->imageLoader(), nullptr);
+  EXPECT_NE(singleton->scaledImageCache(), nullptr);
 }
 
 }  // namespace cszb_scoreboard::test
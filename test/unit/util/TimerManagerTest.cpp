@@ -18,9 +18,12 @@ limitations under the License.
 
 #include <gtest/gtest.h>  // for Test, TestInfo (ptr only)
 
-#include <memory>  // for allocator
+#include <cstdint>   // for int64_t
+#include <memory>    // for allocator
+#include <optional>  // for optional, nullopt
 
 #include "test/mocks/util/MockSingleton.h"  // for MockSingleton
+#include "util/AnimationClock.h"            // for AnimationClock
 #include "util/Singleton.h"                 // for SingletonClass
 #include "util/TimerManager.h"              // for TimerManager
 
@@ -66,6 +69,58 @@ TEST(TimerManagerTest, StartPauseTimer) {
   EXPECT_FALSE(timer_manager.timerRunning());
 }
 
+TEST(TimerManagerTest, NextDisplayChange) {
+  MockSingleton singleton;
+  TimerManager timer_manager(SingletonClass{}, &singleton);
+  int64_t now = AnimationClock::now();
+
+  // A stopped timer never changes on its own.
+  timer_manager.setTime(10);
+  EXPECT_EQ(timer_manager.nextDisplayChange(now), std::nullopt);
+
+  // A running timer changes at the next second boundary.
+  timer_manager.startTimer();
+  std::optional<int64_t> next = timer_manager.nextDisplayChange(now);
+  ASSERT_TRUE(next.has_value());
+  EXPECT_GT(*next, now);
+  // Allow for the clocks to tick between the calls.
+  EXPECT_LE(*next, now + 1002);
+
+  // Once the timer has run out, it stays at zero.
+  EXPECT_EQ(timer_manager.nextDisplayChange(now + 20000), std::nullopt);
+
+  timer_manager.pauseTimer();
+  EXPECT_EQ(timer_manager.nextDisplayChange(now), std::nullopt);
+}
+
+// Changes which a stopped timer won't show on its own ask for a repaint.
+TEST(TimerManagerTest, ChangesRequestRefresh) {
+  MockSingleton singleton;
+  TimerManager timer_manager(SingletonClass{}, &singleton);
+
+  // Setting the time while paused.
+  EXPECT_CALL(singleton, autoRefreshTimer()).WillOnce(Return(nullptr));
+  timer_manager.setTime(10);
+  ::testing::Mock::VerifyAndClearExpectations(&singleton);
+
+  // Showing a paused timer.
+  EXPECT_CALL(singleton, autoRefreshTimer()).WillOnce(Return(nullptr));
+  timer_manager.showTimer();
+  ::testing::Mock::VerifyAndClearExpectations(&singleton);
+
+  // Pausing, after starting (which wakes the refresh timer).
+  EXPECT_CALL(singleton, autoRefreshTimer())
+      .Times(2)
+      .WillRepeatedly(Return(nullptr));
+  timer_manager.startTimer();
+  timer_manager.pauseTimer();
+  ::testing::Mock::VerifyAndClearExpectations(&singleton);
+
+  // Pausing a paused timer changes nothing.
+  EXPECT_CALL(singleton, autoRefreshTimer()).Times(0);
+  timer_manager.pauseTimer();
+}
+
 TEST(TimerManagerTest, ShowHideTimer) {
   MockSingleton singleton;
   TimerManager timer_manager(SingletonClass{}, &singleton);
@@ -0,0 +1,56 @@
+/*
+test/util/TaskQueue.h: Stands in for the UI thread's event queue in tests, so
+that they decide when work handed back from background threads is run.
+
+Copyright 2026 Tracy Beck
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+*/
+
+#pragma once
+#include <condition_variable>
+#include <deque>
+#include <functional>
+#include <mutex>
+
+namespace cszb_scoreboard::test {
+
+class TaskQueue {
+ public:
+  // A function to pass as a dispatcher, which queues each task it's given.
+  auto dispatcher() -> std::function<void(const std::function<void()>&)> {
+    return [this](const std::function<void()>& task) -> void {
+      {
+        std::lock_guard<std::mutex> lock(mutex);
+        tasks.push_back(task);
+      }
+      ready.notify_one();
+    };
+  }
+
+  // Waits for the next task to be queued, and returns it without running it.
+  auto next() -> std::function<void()> {
+    std::unique_lock<std::mutex> lock(mutex);
+    ready.wait(lock, [this]() -> bool { return !tasks.empty(); });
+    std::function<void()> task = tasks.front();
+    tasks.pop_front();
+    return task;
+  }
+
+ private:
+  std::mutex mutex;
+  std::condition_variable ready;
+  std::deque<std::function<void()>> tasks;
+};
+
+}  // namespace cszb_scoreboard::test